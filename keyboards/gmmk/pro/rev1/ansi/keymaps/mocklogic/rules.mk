@@ -1,4 +1,3 @@
 ENCODER_MAP_ENABLE = yes
-TAP_DANCE_ENABLE = yes
 LEADER_ENABLE = yes
 OS_DETECTION_ENABLE = yes
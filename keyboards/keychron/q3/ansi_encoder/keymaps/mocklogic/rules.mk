@@ -1,3 +1,2 @@
 ENCODER_MAP_ENABLE = yes
-TAP_DANCE_ENABLE = yes
 LEADER_ENABLE = yes
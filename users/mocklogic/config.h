@@ -32,26 +32,42 @@
 
 #define AUTOCORRECT_MIN_LENGTH 5
 
+// ============================================================================
+// EEPROM User Datablock (layout in mocklogic.h)
+// ============================================================================
+
+#define EECONFIG_USER_DATA_SIZE    680
+#define EECONFIG_USER_DATA_VERSION 3
+
 // ============================================================================
 // RGB Matrix Settings - Only enable effects we actually use
 // ============================================================================
 
 #ifdef RGB_MATRIX_ENABLE
-    #define RGB_MATRIX_FRAMEBUFFER_EFFECTS
+    // No RGB_MATRIX_FRAMEBUFFER_EFFECTS: the heatmap and rain effects are the
+    // framebuffer-free userspace versions in rgb_matrix_user.inc
     #define RGB_MATRIX_KEYPRESSES
 
-    // Enable ONLY the 8 RGB effects used in _RGB_CFG layer (F1-F4, F9-F12)
+    // Enable ONLY the built-in RGB effects used in _RGB_CFG layer
     #define ENABLE_RGB_MATRIX_SOLID_COLOR           // F1: Solid color
     #define ENABLE_RGB_MATRIX_STARLIGHT_DUAL_HUE    // F2: Starlight
     #define ENABLE_RGB_MATRIX_RAINDROPS             // F3: Raindrops
-    #define ENABLE_RGB_MATRIX_DIGITAL_RAIN          // F4: Digital Rain
     #define ENABLE_RGB_MATRIX_CYCLE_PINWHEEL        // F9: Spiral/Pinwheel
     #define ENABLE_RGB_MATRIX_MULTISPLASH           // F10: Splash ripples
     #define ENABLE_RGB_MATRIX_RIVERFLOW             // F11: Riverflow
-    #define ENABLE_RGB_MATRIX_TYPING_HEATMAP        // F12: Typing Heatmap
+    // F4: column rain and F12: sparse heatmap are userspace effects
 
-    // Presets 1-3 use SOLID_COLOR, Preset 4 uses TYPING_HEATMAP
+    // Presets 1-3 use SOLID_COLOR, Preset 4 uses the sparse heatmap
     // All 32+ other built-in effects are disabled to save ~18KB
 
     #define RGB_DISABLE_WHEN_USB_SUSPENDED
+
+    // Frame governor (features/rgb_governor.c): the flush limit follows the
+    // active effect - slow for static colors, full rate for animations
+    #ifndef __ASSEMBLER__
+        #include <stdint.h>
+        extern uint8_t rgb_frame_ms;
+    #endif
+    #undef RGB_MATRIX_LED_FLUSH_LIMIT
+    #define RGB_MATRIX_LED_FLUSH_LIMIT rgb_frame_ms
 #endif
@@ -0,0 +1,109 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "autocorrect_stats.h"
+#include "scheduler.h"
+#include "mocklogic.h"
+#include <string.h>
+
+// Hit counters for the most frequent corrections. The table uses the
+// space-saving algorithm: when full, a new typo replaces the entry with the
+// fewest hits and inherits its count, so heavy hitters are never evicted.
+// Entries are keyed by typo text rather than trie offset so the counts stay
+// meaningful across dictionary rebuilds.
+static autocorrect_stats_entry_t stats[AUTOCORRECT_STATS_SIZE];
+
+_Static_assert(sizeof(stats) <= DATABLOCK_AUTOCORRECT_STATS_SIZE, "Autocorrect stats exceed datablock region");
+
+static bool stats_dirty;
+
+// Scheduler: flush interval elapsed since the first unsaved hit
+static uint32_t autocorrect_stats_flush_due(void) {
+    autocorrect_stats_flush();
+    return 0;
+}
+
+// Mark counters changed; the first change arms a single deferred flush
+static void mark_dirty(void) {
+    if (!stats_dirty) {
+        stats_dirty = true;
+        scheduler_wake_in(SCHED_AUTOCORRECT_STATS, AUTOCORRECT_STATS_FLUSH_INTERVAL);
+    }
+}
+
+void autocorrect_stats_init(void) {
+    userspace_datablock_read(stats, DATABLOCK_AUTOCORRECT_STATS_OFFSET, sizeof(stats));
+
+    // Make sure every stored typo is terminated (guards against stale data)
+    for (uint8_t i = 0; i < AUTOCORRECT_STATS_SIZE; i++) {
+        stats[i].typo[AUTOCORRECT_STATS_TYPO_SIZE - 1] = '\0';
+    }
+
+    stats_dirty = false;
+    scheduler_register(SCHED_AUTOCORRECT_STATS, autocorrect_stats_flush_due);
+}
+
+void autocorrect_stats_record(const char *typo) {
+    uint8_t min_index = 0;
+
+    for (uint8_t i = 0; i < AUTOCORRECT_STATS_SIZE; i++) {
+        if (stats[i].hits == 0) {
+            // Free slot - counters fill from the front, so no match follows
+            min_index = i;
+            break;
+        }
+        if (strncmp(stats[i].typo, typo, AUTOCORRECT_STATS_TYPO_SIZE - 1) == 0) {
+            if (stats[i].hits < UINT16_MAX) {
+                stats[i].hits++;
+                mark_dirty();
+            }
+            return;
+        }
+        if (stats[i].hits < stats[min_index].hits) {
+            min_index = i;
+        }
+    }
+
+    // New typo: take a free slot or evict the least frequent entry
+    autocorrect_stats_entry_t *entry = &stats[min_index];
+    if (entry->hits < UINT16_MAX) {
+        entry->hits++;
+    }
+    strncpy(entry->typo, typo, AUTOCORRECT_STATS_TYPO_SIZE - 1);
+    entry->typo[AUTOCORRECT_STATS_TYPO_SIZE - 1] = '\0';
+    mark_dirty();
+}
+
+void autocorrect_stats_flush(void) {
+    if (!stats_dirty) {
+        return;
+    }
+    userspace_datablock_write(stats, DATABLOCK_AUTOCORRECT_STATS_OFFSET, sizeof(stats));
+    stats_dirty = false;
+    scheduler_cancel(SCHED_AUTOCORRECT_STATS);
+}
+
+void autocorrect_stats_dump(void) {
+    // Selection order by hits (table is tiny, so no sort buffer is needed)
+    bool printed[AUTOCORRECT_STATS_SIZE] = {false};
+
+    for (uint8_t n = 0; n < AUTOCORRECT_STATS_SIZE; n++) {
+        uint8_t best = AUTOCORRECT_STATS_SIZE;
+        for (uint8_t i = 0; i < AUTOCORRECT_STATS_SIZE; i++) {
+            if (printed[i] || stats[i].hits == 0) {
+                continue;
+            }
+            if (best == AUTOCORRECT_STATS_SIZE || stats[i].hits > stats[best].hits) {
+                best = i;
+            }
+        }
+        if (best == AUTOCORRECT_STATS_SIZE) {
+            break;
+        }
+        printed[best] = true;
+
+        send_string(stats[best].typo);
+        send_string(get_u16_str(stats[best].hits, ' '));
+        send_char('\n');
+    }
+}
@@ -0,0 +1,36 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Number of dictionary entries tracked (space-saving top-K table)
+#ifndef AUTOCORRECT_STATS_SIZE
+    #define AUTOCORRECT_STATS_SIZE 16
+#endif
+
+// Delay from the first unsaved hit to the EEPROM flush (ms)
+#ifndef AUTOCORRECT_STATS_FLUSH_INTERVAL
+    #define AUTOCORRECT_STATS_FLUSH_INTERVAL (15 * 60 * 1000UL)
+#endif
+
+// Typo storage per entry (AUTOCORRECT_MAX_LENGTH of the dictionary + NUL)
+#define AUTOCORRECT_STATS_TYPO_SIZE 12
+
+typedef struct {
+    uint16_t hits;
+    char     typo[AUTOCORRECT_STATS_TYPO_SIZE];
+} autocorrect_stats_entry_t;
+
+// Load persisted counters from the user datablock
+void autocorrect_stats_init(void);
+
+// Record a correction (called from apply_autocorrect)
+void autocorrect_stats_record(const char *typo);
+
+// Write counters to the user datablock now if they changed
+void autocorrect_stats_flush(void);
+
+// Type the table as "typo hits" lines, most frequent first
+void autocorrect_stats_dump(void);
@@ -0,0 +1,93 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Generated by users/mocklogic/tools/gen_color_lut.py - do not edit
+
+#pragma once
+
+// RGB for each hue at full saturation and value (QMK hsv_to_rgb math)
+static const uint8_t PROGMEM hue_wheel[256][3] = {
+    {255,   0,   0}, {255,   6,   0}, {255,  12,   0}, {255,  18,   0},
+    {255,  24,   0}, {255,  30,   0}, {255,  36,   0}, {255,  42,   0},
+    {255,  48,   0}, {255,  54,   0}, {255,  60,   0}, {255,  66,   0},
+    {255,  72,   0}, {255,  78,   0}, {255,  84,   0}, {255,  90,   0},
+    {255,  96,   0}, {255, 102,   0}, {255, 108,   0}, {255, 114,   0},
+    {255, 120,   0}, {255, 126,   0}, {255, 132,   0}, {255, 138,   0},
+    {255, 144,   0}, {255, 150,   0}, {255, 156,   0}, {255, 162,   0},
+    {255, 168,   0}, {255, 174,   0}, {255, 180,   0}, {255, 186,   0},
+    {255, 192,   0}, {255, 198,   0}, {255, 204,   0}, {255, 210,   0},
+    {255, 216,   0}, {255, 222,   0}, {255, 228,   0}, {255, 234,   0},
+    {255, 240,   0}, {255, 246,   0}, {255, 252,   0}, {252, 255,   0},
+    {246, 255,   0}, {240, 255,   0}, {234, 255,   0}, {228, 255,   0},
+    {222, 255,   0}, {216, 255,   0}, {210, 255,   0}, {204, 255,   0},
+    {198, 255,   0}, {192, 255,   0}, {186, 255,   0}, {180, 255,   0},
+    {174, 255,   0}, {168, 255,   0}, {162, 255,   0}, {156, 255,   0},
+    {150, 255,   0}, {144, 255,   0}, {138, 255,   0}, {132, 255,   0},
+    {126, 255,   0}, {120, 255,   0}, {114, 255,   0}, {108, 255,   0},
+    {102, 255,   0}, { 96, 255,   0}, { 90, 255,   0}, { 84, 255,   0},
+    { 78, 255,   0}, { 72, 255,   0}, { 66, 255,   0}, { 60, 255,   0},
+    { 54, 255,   0}, { 48, 255,   0}, { 42, 255,   0}, { 36, 255,   0},
+    { 30, 255,   0}, { 24, 255,   0}, { 18, 255,   0}, { 12, 255,   0},
+    {  6, 255,   0}, {  0, 255,   0}, {  0, 255,   6}, {  0, 255,  12},
+    {  0, 255,  18}, {  0, 255,  24}, {  0, 255,  30}, {  0, 255,  36},
+    {  0, 255,  42}, {  0, 255,  48}, {  0, 255,  54}, {  0, 255,  60},
+    {  0, 255,  66}, {  0, 255,  72}, {  0, 255,  78}, {  0, 255,  84},
+    {  0, 255,  90}, {  0, 255,  96}, {  0, 255, 102}, {  0, 255, 108},
+    {  0, 255, 114}, {  0, 255, 120}, {  0, 255, 126}, {  0, 255, 132},
+    {  0, 255, 138}, {  0, 255, 144}, {  0, 255, 150}, {  0, 255, 156},
+    {  0, 255, 162}, {  0, 255, 168}, {  0, 255, 174}, {  0, 255, 180},
+    {  0, 255, 186}, {  0, 255, 192}, {  0, 255, 198}, {  0, 255, 204},
+    {  0, 255, 210}, {  0, 255, 216}, {  0, 255, 222}, {  0, 255, 228},
+    {  0, 255, 234}, {  0, 255, 240}, {  0, 255, 246}, {  0, 255, 252},
+    {  0, 252, 255}, {  0, 246, 255}, {  0, 240, 255}, {  0, 234, 255},
+    {  0, 228, 255}, {  0, 222, 255}, {  0, 216, 255}, {  0, 210, 255},
+    {  0, 204, 255}, {  0, 198, 255}, {  0, 192, 255}, {  0, 186, 255},
+    {  0, 180, 255}, {  0, 174, 255}, {  0, 168, 255}, {  0, 162, 255},
+    {  0, 156, 255}, {  0, 150, 255}, {  0, 144, 255}, {  0, 138, 255},
+    {  0, 132, 255}, {  0, 126, 255}, {  0, 120, 255}, {  0, 114, 255},
+    {  0, 108, 255}, {  0, 102, 255}, {  0,  96, 255}, {  0,  90, 255},
+    {  0,  84, 255}, {  0,  78, 255}, {  0,  72, 255}, {  0,  66, 255},
+    {  0,  60, 255}, {  0,  54, 255}, {  0,  48, 255}, {  0,  42, 255},
+    {  0,  36, 255}, {  0,  30, 255}, {  0,  24, 255}, {  0,  18, 255},
+    {  0,  12, 255}, {  0,   6, 255}, {  0,   0, 255}, {  6,   0, 255},
+    { 12,   0, 255}, { 18,   0, 255}, { 24,   0, 255}, { 30,   0, 255},
+    { 36,   0, 255}, { 42,   0, 255}, { 48,   0, 255}, { 54,   0, 255},
+    { 60,   0, 255}, { 66,   0, 255}, { 72,   0, 255}, { 78,   0, 255},
+    { 84,   0, 255}, { 90,   0, 255}, { 96,   0, 255}, {102,   0, 255},
+    {108,   0, 255}, {114,   0, 255}, {120,   0, 255}, {126,   0, 255},
+    {132,   0, 255}, {138,   0, 255}, {144,   0, 255}, {150,   0, 255},
+    {156,   0, 255}, {162,   0, 255}, {168,   0, 255}, {174,   0, 255},
+    {180,   0, 255}, {186,   0, 255}, {192,   0, 255}, {198,   0, 255},
+    {204,   0, 255}, {210,   0, 255}, {216,   0, 255}, {222,   0, 255},
+    {228,   0, 255}, {234,   0, 255}, {240,   0, 255}, {246,   0, 255},
+    {252,   0, 255}, {255,   0, 252}, {255,   0, 246}, {255,   0, 240},
+    {255,   0, 234}, {255,   0, 228}, {255,   0, 222}, {255,   0, 216},
+    {255,   0, 210}, {255,   0, 204}, {255,   0, 198}, {255,   0, 192},
+    {255,   0, 186}, {255,   0, 180}, {255,   0, 174}, {255,   0, 168},
+    {255,   0, 162}, {255,   0, 156}, {255,   0, 150}, {255,   0, 144},
+    {255,   0, 138}, {255,   0, 132}, {255,   0, 126}, {255,   0, 120},
+    {255,   0, 114}, {255,   0, 108}, {255,   0, 102}, {255,   0,  96},
+    {255,   0,  90}, {255,   0,  84}, {255,   0,  78}, {255,   0,  72},
+    {255,   0,  66}, {255,   0,  60}, {255,   0,  54}, {255,   0,  48},
+    {255,   0,  42}, {255,   0,  36}, {255,   0,  30}, {255,   0,  24},
+    {255,   0,  18}, {255,   0,  12}, {255,   0,   6}, {255,   0,   0},
+};
+
+// Linear input -> perceptual brightness (gamma 2.2)
+static const uint8_t PROGMEM gamma_lut[256] = {
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   1,
+      1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+      3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+      6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+     12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+     20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+     30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+     42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+     56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+     73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+     91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+    113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+    137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+    163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+    192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
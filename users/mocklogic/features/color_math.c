@@ -0,0 +1,45 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "color_math.h"
+#include "color_lut.h"
+
+static const uint8_t white_balance[3] = COLOR_WHITE_BALANCE;
+
+RGB color_hsv_to_rgb(HSV hsv) {
+    const uint8_t *wheel = hue_wheel[hsv.h];
+    uint8_t        c[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        // Desaturate towards white, then scale by value
+        uint8_t full = 255 - scale8(255 - pgm_read_byte(&wheel[i]), hsv.s);
+        c[i]         = scale8(full, hsv.v);
+    }
+    return (RGB){c[0], c[1], c[2]};
+}
+
+void color_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = color_hsv_to_rgb(hsv[i]);
+    }
+}
+
+uint8_t color_gamma8(uint8_t level) {
+    return pgm_read_byte(&gamma_lut[level]);
+}
+
+void color_balance_batch(RGB *rgb, uint8_t count) {
+    if (white_balance[0] == 255 && white_balance[1] == 255 && white_balance[2] == 255) {
+        return;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i].r = scale8(rgb[i].r, white_balance[0]);
+        rgb[i].g = scale8(rgb[i].g, white_balance[1]);
+        rgb[i].b = scale8(rgb[i].b, white_balance[2]);
+    }
+}
+
+HSV color_trim_preset(HSV hsv) {
+    hsv.h += COLOR_PRESET_HUE_TRIM;
+    hsv.s = (COLOR_PRESET_SAT_TRIM >= 0) ? qadd8(hsv.s, COLOR_PRESET_SAT_TRIM) : qsub8(hsv.s, -(COLOR_PRESET_SAT_TRIM));
+    return hsv;
+}
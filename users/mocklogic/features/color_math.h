@@ -0,0 +1,54 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Userspace color math on lookup tables (tools/gen_color_lut.py): a PROGMEM
+// hue wheel for HSV -> RGB, a gamma curve for brightness fades, and a
+// per-board white balance applied to everything the indicators draw.
+
+// Per-board calibration. The Keychron boards are the reference; the GMMK Pro
+// LEDs run cooler and get less green/blue and a warmer trim on the fixed
+// warm white presets. Adjust by comparing boards side by side at preset 2.
+#if defined(KEYBOARD_gmmk_pro)
+#    ifndef COLOR_WHITE_BALANCE
+#        define COLOR_WHITE_BALANCE {255, 220, 180}
+#    endif
+#    ifndef COLOR_PRESET_HUE_TRIM
+#        define COLOR_PRESET_HUE_TRIM 3
+#    endif
+#    ifndef COLOR_PRESET_SAT_TRIM
+#        define COLOR_PRESET_SAT_TRIM 20
+#    endif
+#endif
+
+// Per-channel maximum (255 = unchanged)
+#ifndef COLOR_WHITE_BALANCE
+#    define COLOR_WHITE_BALANCE {255, 255, 255}
+#endif
+
+// Added to the hue / saturation of the fixed presets (QMK renders those, so
+// they can only be calibrated in HSV)
+#ifndef COLOR_PRESET_HUE_TRIM
+#    define COLOR_PRESET_HUE_TRIM 0
+#endif
+#ifndef COLOR_PRESET_SAT_TRIM
+#    define COLOR_PRESET_SAT_TRIM 0
+#endif
+
+// HSV -> RGB from the hue wheel (same result as hsv_to_rgb(), no per-pixel math)
+RGB color_hsv_to_rgb(HSV hsv);
+
+// Convert count colors at once
+void color_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count);
+
+// Linear level -> perceptual brightness, for fades
+uint8_t color_gamma8(uint8_t level);
+
+// Apply the board's white balance in place
+void color_balance_batch(RGB *rgb, uint8_t count);
+
+// Apply the board's trims to a fixed preset
+HSV color_trim_preset(HSV hsv);
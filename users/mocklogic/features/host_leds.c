@@ -0,0 +1,97 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "host_leds.h"
+#include "overlay.h"
+#include "perf.h"
+#include <string.h>
+
+static led_t led_state;
+
+#ifdef RGB_MATRIX_ENABLE
+
+// One entry per led_t bit, in bit order
+typedef struct {
+    uint16_t keycode;
+    RGB      color;
+} lock_key_t;
+
+static const lock_key_t lock_keys[] = {
+    {KC_NUM,  {RGB_BLUE}},  // Num Lock
+    {KC_CAPS, {RGB_BLUE}},  // Caps Lock
+    {KC_SCRL, {RGB_BLUE}},  // Scroll Lock
+    {KC_APP,  {RGB_BLUE}},  // Compose
+    {KC_INT2, {RGB_BLUE}},  // Kana
+};
+
+#define LOCK_KEY_COUNT ARRAY_SIZE(lock_keys)
+
+// LED under each lock key on the default layer (NO_LED if it has none)
+static uint8_t lock_leds[LOCK_KEY_COUNT];
+
+// Precomputed frame writes for the locks that are on
+static struct {
+    uint8_t led;
+    RGB     color;
+} writes[LOCK_KEY_COUNT];
+static uint8_t write_count;
+
+static void rebuild_writes(void) {
+    write_count = 0;
+    for (uint8_t i = 0; i < LOCK_KEY_COUNT; i++) {
+        if ((led_state.raw & (1 << i)) && lock_leds[i] != NO_LED) {
+            writes[write_count].led   = lock_leds[i];
+            writes[write_count].color = lock_keys[i].color;
+            write_count++;
+        }
+    }
+}
+
+void host_leds_set_layer(uint8_t layer) {
+    memset(lock_leds, NO_LED, sizeof(lock_leds));
+
+    // One pass over the keymap for all lock keys
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led == NO_LED) {
+                continue;
+            }
+            PERF_COUNT(PERF_COUNT_KEYMAP_READS);
+            uint16_t keycode = keymap_key_to_keycode(layer, (keypos_t){col, row});
+            for (uint8_t i = 0; i < LOCK_KEY_COUNT; i++) {
+                if (keycode == lock_keys[i].keycode && lock_leds[i] == NO_LED) {
+                    lock_leds[i] = led;
+                }
+            }
+        }
+    }
+    rebuild_writes();
+}
+
+void host_leds_render(void) {
+    for (uint8_t i = 0; i < write_count; i++) {
+        overlay_set(writes[i].led, writes[i].color.r, writes[i].color.g, writes[i].color.b, OVERLAY_OPAQUE);
+    }
+}
+
+#else
+
+void host_leds_set_layer(uint8_t layer) {
+    (void)layer;
+}
+
+void host_leds_render(void) {}
+
+#endif // RGB_MATRIX_ENABLE
+
+void host_leds_update(led_t state) {
+    led_state = state;
+#ifdef RGB_MATRIX_ENABLE
+    rebuild_writes();
+#endif
+}
+
+led_t host_leds_state(void) {
+    return led_state;
+}
@@ -0,0 +1,24 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Host lock LEDs (Num/Caps/Scroll/Compose/Kana) shown on their keys. The
+// state comes from led_update_user() and the LED under each lock key is
+// looked up once per default layer, so a frame only replays a short list of
+// precomputed writes instead of querying the host state and searching the
+// keymap.
+
+// Call from led_update_user()
+void host_leds_update(led_t state);
+
+// Default layer changed: find the lock keys on it
+void host_leds_set_layer(uint8_t layer);
+
+// Cached host LED state
+led_t host_leds_state(void);
+
+// Overlay draw function: the active lock keys
+void host_leds_render(void);
@@ -0,0 +1,79 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "host_profile.h"
+
+// Inputs
+static host_override_t override_input = HOST_OVERRIDE_AUTO;
+static bool            base_layer_mac = false;
+#ifdef OS_DETECTION_ENABLE
+static os_variant_t    detected_input = OS_UNSURE;
+#endif
+
+// Resolved profile and its listener
+static host_profile_t          profile  = HOST_PROFILE_WIN;
+static host_profile_callback_t callback = NULL;
+
+static host_profile_t resolve(void) {
+    switch (override_input) {
+        case HOST_OVERRIDE_MAC:
+            return HOST_PROFILE_MAC;
+        case HOST_OVERRIDE_WIN:
+            return HOST_PROFILE_WIN;
+        default:
+            break;
+    }
+
+#ifdef OS_DETECTION_ENABLE
+    switch (detected_input) {
+        case OS_MACOS:
+        case OS_IOS:
+            return HOST_PROFILE_MAC;
+        case OS_WINDOWS:
+        case OS_LINUX:
+            return HOST_PROFILE_WIN;
+        default:
+            break;
+    }
+#endif
+
+    return base_layer_mac ? HOST_PROFILE_MAC : HOST_PROFILE_WIN;
+}
+
+static void update(bool force_notify) {
+    host_profile_t resolved = resolve();
+    if (resolved == profile && !force_notify) {
+        return;
+    }
+    profile = resolved;
+    if (callback) {
+        callback(profile);
+    }
+}
+
+void host_profile_init(host_override_t override, host_profile_callback_t cb) {
+    override_input = override;
+    callback       = cb;
+    update(true);
+}
+
+void host_profile_set_base_layer_mac(bool is_mac) {
+    base_layer_mac = is_mac;
+    update(false);
+}
+
+void host_profile_set_override(host_override_t override) {
+    override_input = override;
+    update(false);
+}
+
+#ifdef OS_DETECTION_ENABLE
+void host_profile_set_detected(os_variant_t detected_os) {
+    detected_input = detected_os;
+    update(false);
+}
+#endif
+
+host_profile_t host_profile_get(void) {
+    return profile;
+}
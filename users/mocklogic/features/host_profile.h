@@ -0,0 +1,46 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Host profile: which OS the OS-aware keys (select word, task view/manager,
+// file explorer, zoom) target. It merges three inputs into one cached value:
+//
+//   1. Manual override (Leader + MAC / WIN / AUTO, stored in EEPROM)
+//   2. Detected host OS (boards with OS_DETECTION_ENABLE, once known)
+//   3. Default layer (the Keychron OS switch, or the layout persisted by OS
+//      detection on boards without a switch)
+//
+// The first input that has an opinion wins. Readers get the cached value in
+// O(1); the change callback runs only when the resolved profile changes.
+typedef enum {
+    HOST_PROFILE_WIN = 0,  // Windows and Linux hotkeys
+    HOST_PROFILE_MAC,      // macOS and iOS hotkeys
+} host_profile_t;
+
+typedef enum {
+    HOST_OVERRIDE_AUTO = 0,  // Follow detection / default layer
+    HOST_OVERRIDE_MAC,
+    HOST_OVERRIDE_WIN,
+} host_override_t;
+
+typedef void (*host_profile_callback_t)(host_profile_t profile);
+
+// Set the override and callback; the callback runs once with the current profile
+void host_profile_init(host_override_t override, host_profile_callback_t callback);
+
+// Inputs
+void host_profile_set_base_layer_mac(bool is_mac);
+void host_profile_set_override(host_override_t override);
+#ifdef OS_DETECTION_ENABLE
+void host_profile_set_detected(os_variant_t detected_os);
+#endif
+
+// Resolved profile (cached)
+host_profile_t host_profile_get(void);
+
+static inline bool host_profile_is_mac(void) {
+    return host_profile_get() == HOST_PROFILE_MAC;
+}
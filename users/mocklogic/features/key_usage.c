@@ -0,0 +1,174 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_usage.h"
+#include "scheduler.h"
+#include "mocklogic.h"
+#ifdef RGB_MATRIX_ENABLE
+#    include "overlay.h"
+#    include "color_math.h"
+#endif
+
+// Totals are stored row by row, MATRIX_COLS uint32_t per row
+_Static_assert(MATRIX_ROWS * MATRIX_COLS <= KEY_USAGE_MAX_KEYS, "Matrix exceeds KEY_USAGE_MAX_KEYS");
+_Static_assert(KEY_USAGE_MAX_KEYS * sizeof(uint32_t) <= DATABLOCK_KEY_USAGE_SIZE, "Key usage exceeds datablock region");
+
+// Presses since the last flush
+static uint16_t pending[MATRIX_ROWS][MATRIX_COLS];
+static bool     pending_dirty;
+
+// Scheduler: flush interval elapsed, or a counter saturated
+static uint32_t key_usage_flush_due(void) {
+    key_usage_flush();
+    return 0;
+}
+
+void key_usage_init(void) {
+    pending_dirty = false;
+    scheduler_register(SCHED_KEY_USAGE, key_usage_flush_due);
+}
+
+void key_usage_record(keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event)) {
+        return;
+    }
+    uint16_t *count = &pending[record->event.key.row][record->event.key.col];
+    if (*count == UINT16_MAX) {
+        return;  // Flush already due
+    }
+    if (!pending_dirty) {
+        pending_dirty = true;
+        scheduler_wake_in(SCHED_KEY_USAGE, KEY_USAGE_FLUSH_INTERVAL);
+    }
+    if (++*count == UINT16_MAX) {
+        scheduler_wake_in(SCHED_KEY_USAGE, 0);  // Move it to storage on the next pass
+    }
+}
+
+static uint16_t row_offset(uint8_t row) {
+    return DATABLOCK_KEY_USAGE_OFFSET + row * MATRIX_COLS * sizeof(uint32_t);
+}
+
+void key_usage_flush(void) {
+    if (!pending_dirty) {
+        return;
+    }
+    // One read and at most one write per row
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        uint32_t totals[MATRIX_COLS];
+        bool     changed = false;
+        userspace_datablock_read(totals, row_offset(row), sizeof(totals));
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t count = pending[row][col];
+            if (count == 0) {
+                continue;
+            }
+            totals[col]       = (totals[col] > UINT32_MAX - count) ? UINT32_MAX : totals[col] + count;
+            pending[row][col] = 0;
+            changed           = true;
+        }
+        if (changed) {
+            userspace_datablock_write(totals, row_offset(row), sizeof(totals));
+        }
+    }
+    pending_dirty = false;
+    scheduler_cancel(SCHED_KEY_USAGE);
+}
+
+uint32_t key_usage_total(uint8_t row, uint8_t col) {
+    uint32_t total;
+    userspace_datablock_read(&total, row_offset(row) + col * sizeof(uint32_t), sizeof(total));
+    uint16_t count = pending[row][col];
+    return (total > UINT32_MAX - count) ? UINT32_MAX : total + count;
+}
+
+void key_usage_dump(void) {
+    char buf[11];
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint32_t total = key_usage_total(row, col);
+            if (total == 0) {
+                continue;
+            }
+            send_string(get_u8_str(row, ' '));
+            send_string(get_u8_str(col, ' '));
+            send_string(get_numeric_str(buf, sizeof(buf), total, ' '));
+            send_char('\n');
+        }
+    }
+}
+
+#ifdef RGB_MATRIX_ENABLE
+
+static uint8_t view_levels[MATRIX_ROWS][MATRIX_COLS];
+static bool    view_open;
+
+// log2(n) in quarter steps, plus one so that only 0 maps to 0 (at most 128)
+static uint8_t log2_quarters(uint32_t n) {
+    if (n == 0) {
+        return 0;
+    }
+    uint8_t bits = 0;
+    while (n >> (bits + 1)) {
+        bits++;
+    }
+    uint8_t frac = (bits >= 2) ? (n >> (bits - 2)) & 3 : (n << (2 - bits)) & 3;
+    return 1 + bits * 4 + frac;
+}
+
+static void view_snapshot(void) {
+    uint8_t max = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            view_levels[row][col] = log2_quarters(key_usage_total(row, col));
+            if (view_levels[row][col] > max) {
+                max = view_levels[row][col];
+            }
+        }
+    }
+    if (max == 0) {
+        return;
+    }
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            view_levels[row][col] = (uint16_t)view_levels[row][col] * 255 / max;
+        }
+    }
+}
+
+void key_usage_view_toggle(void) {
+    view_open = !view_open;
+    if (view_open) {
+        view_snapshot();
+    }
+}
+
+void key_usage_view_close(void) {
+    view_open = false;
+}
+
+bool key_usage_view_is_open(void) {
+    return view_open;
+}
+
+void key_usage_view_render(void) {
+    uint8_t val = rgb_matrix_get_val();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint8_t led = g_led_config.matrix_co[row][col];
+            if (led == NO_LED) {
+                continue;
+            }
+            uint8_t level = view_levels[row][col];
+            if (level == 0) {
+                overlay_set(led, 0, 0, 0, OVERLAY_OPAQUE);  // Never pressed
+                continue;
+            }
+            HSV hsv = {170 - scale8(170, level), 255, val};
+            RGB rgb = color_hsv_to_rgb(hsv);
+            overlay_set(led, rgb.r, rgb.g, rgb.b, OVERLAY_OPAQUE);
+        }
+    }
+}
+
+#endif // RGB_MATRIX_ENABLE
@@ -0,0 +1,45 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Lifetime press counts per matrix position, to compare key wear across
+// boards. A press only bumps a 16-bit RAM counter; the counters are added to
+// 32-bit totals in the user datablock in one batch when the host suspends,
+// KEY_USAGE_FLUSH_INTERVAL after the first unsaved press, or right away once
+// a counter saturates. Presses since the last flush are lost on power loss.
+
+// Matrix positions reserved in the datablock (rows x cols of the largest board)
+#define KEY_USAGE_MAX_KEYS 112
+
+// Delay from the first unsaved press to the datablock flush (ms)
+#ifndef KEY_USAGE_FLUSH_INTERVAL
+    #define KEY_USAGE_FLUSH_INTERVAL (30 * 60 * 1000UL)
+#endif
+
+void key_usage_init(void);
+
+// Count a key press (called from process_record_user)
+void key_usage_record(keyrecord_t *record);
+
+// Add pending counts to the datablock now if there are any
+void key_usage_flush(void);
+
+// Stored total plus unsaved presses
+uint32_t key_usage_total(uint8_t row, uint8_t col);
+
+// Type the counts as "row col presses" lines, skipping unused positions
+void key_usage_dump(void);
+
+#ifdef RGB_MATRIX_ENABLE
+// Heatmap view on the RGB Config layer: levels are computed once when the
+// view opens, so the frame only draws a snapshot
+void key_usage_view_toggle(void);
+void key_usage_view_close(void);
+bool key_usage_view_is_open(void);
+
+// Paint every key by usage, blue (rare) to red (most used); log scale
+void key_usage_view_render(void);
+#endif
@@ -0,0 +1,18 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "multi_tap.h"
+
+uint8_t multi_tap_press(multi_tap_t *tap, uint16_t time, uint16_t term) {
+    if (tap->count > 0 && tap->count < UINT8_MAX && TIMER_DIFF_16(time, tap->last_press) < term) {
+        tap->count++;
+    } else {
+        tap->count = 1;
+    }
+    tap->last_press = time;
+    return tap->count;
+}
+
+void multi_tap_reset(multi_tap_t *tap) {
+    tap->count = 0;
+}
@@ -0,0 +1,20 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Shared multi-tap timing: counts presses of one key that follow each other
+// within a tap term. Used by the layer exit key and select word, so neither
+// needs QMK tap dance (which holds the first tap back for TAPPING_TERM).
+typedef struct {
+    uint16_t last_press;  // Event time of the previous press
+    uint8_t  count;       // Presses in a row, 0 after a reset
+} multi_tap_t;
+
+// Count a press; returns how many presses in a row (1 = first tap)
+uint8_t multi_tap_press(multi_tap_t *tap, uint16_t time, uint16_t term);
+
+// Forget the sequence (e.g. another key was pressed in between)
+void multi_tap_reset(multi_tap_t *tap);
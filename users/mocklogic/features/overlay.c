@@ -0,0 +1,114 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "overlay.h"
+#include "color_math.h"
+#include <string.h>
+
+#ifdef RGB_MATRIX_ENABLE
+
+#define NO_ENTRY 0xFF
+
+_Static_assert(RGB_MATRIX_LED_COUNT < NO_ENTRY, "Overlay entry index must fit in a byte");
+_Static_assert(OVERLAY_COUNT <= 16, "Overlay mask is 16 bits");
+
+// Registry, with draw order kept sorted by priority
+static overlay_draw_t draw_fns[OVERLAY_COUNT];
+static uint8_t        priorities[OVERLAY_COUNT];
+static uint8_t        order[OVERLAY_COUNT];
+static uint8_t        registered_count;
+static uint16_t       active_mask;
+
+// Composed frame: one entry per touched LED (colors kept contiguous so the
+// white balance runs over them as one batch)
+static uint8_t entry_leds[RGB_MATRIX_LED_COUNT];
+static RGB     entry_colors[RGB_MATRIX_LED_COUNT];
+static uint8_t entry_count;
+static uint8_t entry_of_led[RGB_MATRIX_LED_COUNT];
+static bool    entry_map_ready;
+
+void overlay_register(overlay_id_t id, uint8_t priority, overlay_draw_t draw) {
+    if (!draw_fns[id]) {
+        order[registered_count++] = id;
+    }
+    draw_fns[id]   = draw;
+    priorities[id] = priority;
+
+    // Insertion sort: a handful of overlays, registered once at init
+    for (uint8_t i = 1; i < registered_count; i++) {
+        uint8_t cur = order[i];
+        uint8_t j   = i;
+        while (j > 0 && priorities[order[j - 1]] > priorities[cur]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = cur;
+    }
+}
+
+void overlay_set_active(overlay_id_t id, bool active) {
+    if (active) {
+        active_mask |= (1 << id);
+    } else {
+        active_mask &= ~(1 << id);
+    }
+}
+
+static inline uint8_t blend8(uint8_t below, uint8_t above, uint8_t alpha) {
+    return scale8(below, 255 - alpha) + scale8(above, alpha);
+}
+
+void overlay_set(uint8_t led, uint8_t r, uint8_t g, uint8_t b, uint8_t alpha) {
+    if (led >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+    uint8_t index = entry_of_led[led];
+    if (index == NO_ENTRY) {
+        index               = entry_count++;
+        entry_of_led[led]   = index;
+        entry_leds[index]   = led;
+        entry_colors[index] = (RGB){0, 0, 0};
+    }
+    RGB *c = &entry_colors[index];
+    if (alpha == OVERLAY_OPAQUE) {
+        *c = (RGB){r, g, b};
+        return;
+    }
+    c->r   = blend8(c->r, r, alpha);
+    c->g   = blend8(c->g, g, alpha);
+    c->b   = blend8(c->b, b, alpha);
+}
+
+static void compose(void) {
+    if (!entry_map_ready) {
+        memset(entry_of_led, NO_ENTRY, sizeof(entry_of_led));
+        entry_map_ready = true;
+    }
+    // Forget last frame's LEDs (only the ones it touched)
+    for (uint8_t i = 0; i < entry_count; i++) {
+        entry_of_led[entry_leds[i]] = NO_ENTRY;
+    }
+    entry_count = 0;
+
+    for (uint8_t i = 0; i < registered_count; i++) {
+        uint8_t id = order[i];
+        if (active_mask & (1 << id)) {
+            draw_fns[id]();
+        }
+    }
+    color_balance_batch(entry_colors, entry_count);
+}
+
+void overlay_render(uint8_t led_min, uint8_t led_max) {
+    if (led_min == 0) {
+        compose();
+    }
+    for (uint8_t i = 0; i < entry_count; i++) {
+        uint8_t led = entry_leds[i];
+        if (led >= led_min && led < led_max) {
+            rgb_matrix_set_color(led, entry_colors[i].r, entry_colors[i].g, entry_colors[i].b);
+        }
+    }
+}
+
+#endif // RGB_MATRIX_ENABLE
@@ -0,0 +1,45 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// RGB overlay compositor. Each indicator source is an overlay with a
+// priority and a draw function that lists the LEDs it touches with
+// overlay_set(). Once per frame the active overlays are drawn in priority
+// order into a sparse list - one entry per touched LED, with higher
+// priorities blended over lower ones - and every [led_min, led_max) chunk
+// writes only the entries in its range. An overlay costs only the LEDs it
+// touches, and overlapping overlays no longer depend on call order.
+//
+// There is no readback of the effect below, so an entry that is not covered
+// by a lower overlay blends with black (alpha scales its color).
+typedef enum {
+    OVERLAY_FEATURES,  // _FEATURES layer key colors
+    OVERLAY_GAMING,    // _GAMING layer
+    OVERLAY_MOUSE,     // _MOUSE layer
+    OVERLAY_KIDDO,     // Whack-a-mole game
+    OVERLAY_RGB_CFG,   // _RGB_CFG layer
+    OVERLAY_LEADER,    // Leader sequence in progress
+    OVERLAY_LOCKS,     // Caps Lock etc. (features/host_leds.c)
+    OVERLAY_COUNT
+} overlay_id_t;
+
+#define OVERLAY_OPAQUE 255
+
+// Lists the overlay's LEDs with overlay_set()
+typedef void (*overlay_draw_t)(void);
+
+// Set an overlay's draw function and priority (higher is drawn on top)
+void overlay_register(overlay_id_t id, uint8_t priority, overlay_draw_t draw);
+
+// Only active overlays are drawn
+void overlay_set_active(overlay_id_t id, bool active);
+
+// From a draw function: color one LED (alpha 255 = opaque)
+void overlay_set(uint8_t led, uint8_t r, uint8_t g, uint8_t b, uint8_t alpha);
+
+// From rgb_matrix_indicators_advanced_user(): compose on the first chunk of
+// a frame, then write the entries in [led_min, led_max)
+void overlay_render(uint8_t led_min, uint8_t led_max);
@@ -0,0 +1,153 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "perf.h"
+
+#include <string.h>
+
+#ifdef MOCKLOGIC_PERF_ENABLE
+
+#    if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#        include <hal.h>
+#        define PERF_TICKS_PER_US (CPU_CLOCK / 1000000UL)
+#    elif !defined(__arm__) && !defined(__AVR__)
+#        include <time.h>
+#        define PERF_TICKS_PER_US 1000UL
+#    else
+#        error "MOCKLOGIC_PERF_ENABLE needs a DWT cycle counter (Cortex-M3 or later) or a host build"
+#    endif
+
+static const char *const probe_names[PERF_PROBE_COUNT] = {
+    [PERF_PROCESS_RECORD] = "process_record",
+    [PERF_SELECT_WORD]    = "select_word",
+    [PERF_AUTOCORRECT]    = "autocorrect",
+    [PERF_INDICATORS]     = "indicators",
+};
+
+static const char *const counter_names[PERF_COUNTER_COUNT] = {
+    [PERF_COUNT_EEPROM_WRITES] = "eeprom",
+    [PERF_COUNT_RGB_MODE]      = "rgb_mode",
+    [PERF_COUNT_KEYMAP_READS]  = "keymap",
+    [PERF_COUNT_HID_REPORTS]   = "hid",
+};
+
+typedef struct {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+    uint16_t histogram[PERF_BUCKETS];
+} perf_stats_t;
+
+static perf_stats_t stats[PERF_PROBE_COUNT];
+static uint32_t     counters[PERF_COUNTER_COUNT];
+
+static void perf_reset(void) {
+    memset(stats, 0, sizeof(stats));
+    memset(counters, 0, sizeof(counters));
+    for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+        stats[i].min = UINT32_MAX;
+    }
+}
+
+void perf_init(void) {
+#    if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#    endif
+    perf_reset();
+}
+
+uint32_t perf_now(void) {
+#    if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    return DWT->CYCCNT;
+#    else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000000UL + ts.tv_nsec;
+#    endif
+}
+
+void perf_record(perf_probe_t probe, uint32_t ticks) {
+    perf_stats_t *s = &stats[probe];
+
+    s->count++;
+    s->sum += ticks;
+    if (ticks < s->min) {
+        s->min = ticks;
+    }
+    if (ticks > s->max) {
+        s->max = ticks;
+    }
+    uint8_t bucket = ticks ? 32 - __builtin_clz(ticks) : 0;
+    if (bucket >= PERF_BUCKETS) {
+        bucket = PERF_BUCKETS - 1;
+    }
+    if (s->histogram[bucket] < UINT16_MAX) {
+        s->histogram[bucket]++;
+    }
+}
+
+void perf_count(perf_counter_t counter) {
+    counters[counter]++;
+}
+
+static void send_number(uint32_t n) {
+    char        buf[11];
+    const char *digits = get_numeric_str(buf, sizeof(buf), n, ' ');
+    while (*digits == ' ') {
+        digits++;
+    }
+    send_string(digits);
+}
+
+// Per probe: "name n <count> min <ticks> avg <ticks> max <ticks>", then the
+// non-empty histogram buckets as "<bit length>:<count>"; last, the call
+// counters as "calls <name> <count> ..."
+void perf_report(void) {
+    send_string("perf ticks/us ");
+    send_number(PERF_TICKS_PER_US);
+    send_char('\n');
+
+    for (uint8_t i = 0; i < PERF_PROBE_COUNT; i++) {
+        const perf_stats_t *s = &stats[i];
+        if (s->count == 0) {
+            continue;
+        }
+        send_string(probe_names[i]);
+        send_string(" n ");
+        send_number(s->count);
+        send_string(" min ");
+        send_number(s->min);
+        send_string(" avg ");
+        send_number(s->sum / s->count);
+        send_string(" max ");
+        send_number(s->max);
+        send_char('\n');
+
+        send_string("  log2");
+        for (uint8_t bucket = 0; bucket < PERF_BUCKETS; bucket++) {
+            if (s->histogram[bucket] == 0) {
+                continue;
+            }
+            send_char(' ');
+            send_number(bucket);
+            send_char(':');
+            send_number(s->histogram[bucket]);
+        }
+        send_char('\n');
+    }
+
+    send_string("calls");
+    for (uint8_t i = 0; i < PERF_COUNTER_COUNT; i++) {
+        send_char(' ');
+        send_string(counter_names[i]);
+        send_char(' ');
+        send_number(counters[i]);
+    }
+    send_char('\n');
+    perf_reset();
+}
+
+#endif // MOCKLOGIC_PERF_ENABLE
@@ -0,0 +1,86 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Timing probes for hot paths. Build with MOCKLOGIC_PERF_ENABLE = yes (see
+// rules.mk) to collect count, min/mean/max and a log2 histogram per probe, in
+// ticks of the backend clock:
+//
+//   Cortex-M3/M4/M7  DWT cycle counter (CPU cycles)
+//   Host build       clock_gettime(CLOCK_MONOTONIC) (nanoseconds)
+//
+// Without it the macros expand to nothing and perf.c is not built.
+//
+//   PERF_SCOPE(PERF_SELECT_WORD);       // Until the enclosing block exits
+//
+//   PERF_BEGIN(PERF_INDICATORS);        // Explicit bracket
+//   ...
+//   PERF_END(PERF_INDICATORS);
+//
+// Call counters track how often userspace reaches for expensive operations.
+// Put PERF_COUNT(id) next to the call; the report lists them with the
+// process_record_user count of the same window, so per-keypress cost shows.
+
+typedef enum {
+    PERF_PROCESS_RECORD,  // process_record_user()
+    PERF_SELECT_WORD,     // process_select_word()
+    PERF_AUTOCORRECT,     // apply_autocorrect() (userspace part of a correction)
+    PERF_INDICATORS,      // rgb_matrix_indicators_advanced_user()
+    PERF_PROBE_COUNT
+} perf_probe_t;
+
+typedef enum {
+    PERF_COUNT_EEPROM_WRITES,  // userspace_config_save(), userspace_datablock_write()
+    PERF_COUNT_RGB_MODE,       // rgb_matrix_mode() from the presets
+    PERF_COUNT_KEYMAP_READS,   // keymap_key_to_keycode() from userspace
+    PERF_COUNT_HID_REPORTS,    // send_keyboard_report() from userspace
+    PERF_COUNTER_COUNT
+} perf_counter_t;
+
+#ifdef MOCKLOGIC_PERF_ENABLE
+
+// Histogram buckets: bit length of the duration in ticks, last one open-ended
+#    ifndef PERF_BUCKETS
+#        define PERF_BUCKETS 24
+#    endif
+
+// Start the clock (called from keyboard_post_init_user)
+void perf_init(void);
+
+// Current tick count (wraps; only differences are meaningful)
+uint32_t perf_now(void);
+
+// Add one measurement to a probe
+void perf_record(perf_probe_t probe, uint32_t ticks);
+
+// Bump a call counter
+void perf_count(perf_counter_t counter);
+
+// Type all probes with samples, then start a new measurement window
+void perf_report(void);
+
+typedef struct {
+    perf_probe_t probe;
+    uint32_t     start;
+} perf_scope_t;
+
+static inline void perf_scope_end(perf_scope_t *scope) {
+    perf_record(scope->probe, perf_now() - scope->start);
+}
+
+#    define PERF_BEGIN(probe) uint32_t perf_start_##probe = perf_now()
+#    define PERF_END(probe) perf_record(probe, perf_now() - perf_start_##probe)
+#    define PERF_SCOPE(probe) perf_scope_t perf_scope_##probe __attribute__((cleanup(perf_scope_end))) = {probe, perf_now()}
+#    define PERF_COUNT(counter) perf_count(counter)
+
+#else
+
+#    define PERF_BEGIN(probe)
+#    define PERF_END(probe)
+#    define PERF_SCOPE(probe)
+#    define PERF_COUNT(counter)
+
+#endif // MOCKLOGIC_PERF_ENABLE
@@ -0,0 +1,237 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_effects.h"
+#include "mocklogic.h"  // Keycodes used by mocklogic_led_map.h
+#include "color_math.h"
+
+#if defined(RGB_MATRIX_ENABLE) && defined(RGB_MATRIX_CUSTOM_USER)
+
+// -----------------------------------------------------------------------------
+// Sparse Heatmap
+// -----------------------------------------------------------------------------
+
+typedef struct {
+    uint8_t led;
+    uint8_t heat;
+} heat_entry_t;
+
+static heat_entry_t heat_keys[SPARSE_HEATMAP_KEYS];
+static uint8_t      heat_count;
+static uint32_t     heat_last_cool;
+
+// Build-time neighbor table from tools/gen_led_map.py (generated by rules.mk),
+// used when it was made for the configured neighbor count and radius
+#if defined(__has_include)
+#    if __has_include("mocklogic_led_map.h")
+#        include "mocklogic_led_map.h"
+#    endif
+#endif
+#if defined(LED_MAP_NEIGHBORS) && LED_MAP_NEIGHBORS == SPARSE_HEATMAP_NEIGHBORS && LED_MAP_NEIGHBOR_RADIUS == SPARSE_HEATMAP_SPREAD_RADIUS
+#    define HEAT_NEIGHBOR_TABLE
+#endif
+
+// Closest key LEDs of a key LED, nearest first; returns how many were found
+static uint8_t heat_find_neighbors(uint8_t led, uint8_t neighbors[SPARSE_HEATMAP_NEIGHBORS]) {
+    uint8_t count = 0;
+#ifdef HEAT_NEIGHBOR_TABLE
+    while (count < SPARSE_HEATMAP_NEIGHBORS && (neighbors[count] = led_map_neighbor(led, count)) != NO_LED) {
+        count++;
+    }
+#else
+    // No table: one pass over the LED positions per press, keeping the
+    // closest few in a sorted list
+    if (!HAS_ANY_FLAGS(g_led_config.flags[led], LED_FLAG_KEYLIGHT)) {
+        return 0;
+    }
+    uint16_t distance[SPARSE_HEATMAP_NEIGHBORS];
+    for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT; j++) {
+        if (j == led || !HAS_ANY_FLAGS(g_led_config.flags[j], LED_FLAG_KEYLIGHT)) {
+            continue;
+        }
+        int16_t  dx = g_led_config.point[j].x - g_led_config.point[led].x;
+        int16_t  dy = g_led_config.point[j].y - g_led_config.point[led].y;
+        uint16_t d  = dx * dx + dy * dy;
+        if (d > SPARSE_HEATMAP_SPREAD_RADIUS * SPARSE_HEATMAP_SPREAD_RADIUS) {
+            continue;
+        }
+
+        // Insertion into the sorted list, dropping the farthest
+        uint8_t k = count < SPARSE_HEATMAP_NEIGHBORS ? count++ : SPARSE_HEATMAP_NEIGHBORS;
+        while (k > 0 && d < distance[k - 1]) {
+            if (k < SPARSE_HEATMAP_NEIGHBORS) {
+                neighbors[k] = neighbors[k - 1];
+                distance[k]  = distance[k - 1];
+            }
+            k--;
+        }
+        if (k < SPARSE_HEATMAP_NEIGHBORS) {
+            neighbors[k] = j;
+            distance[k]  = d;
+        }
+    }
+#endif
+    return count;
+}
+
+// Heat up a tracked key, or take a free slot, or replace the coolest key if it
+// is cooler than the heat being added
+static void heat_add(uint8_t led, uint8_t heat) {
+    uint8_t coolest = 0;
+    for (uint8_t i = 0; i < heat_count; i++) {
+        if (heat_keys[i].led == led) {
+            heat_keys[i].heat = qadd8(heat_keys[i].heat, heat);
+            return;
+        }
+        if (heat_keys[i].heat < heat_keys[coolest].heat) {
+            coolest = i;
+        }
+    }
+    uint8_t slot;
+    if (heat_count < SPARSE_HEATMAP_KEYS) {
+        slot = heat_count++;
+    } else if (heat_keys[coolest].heat < heat) {
+        slot = coolest;
+    } else {
+        return;
+    }
+    heat_keys[slot].led  = led;
+    heat_keys[slot].heat = heat;
+}
+
+void rgb_effects_key_pressed(keyrecord_t *record) {
+    if (rgb_matrix_get_mode() != RGB_MATRIX_CUSTOM_sparse_heatmap || !IS_KEYEVENT(record->event)) {
+        return;
+    }
+    uint8_t led = g_led_config.matrix_co[record->event.key.row][record->event.key.col];
+    if (led == NO_LED) {
+        return;
+    }
+
+    heat_add(led, SPARSE_HEATMAP_HEAT_STEP);
+    uint8_t neighbors[SPARSE_HEATMAP_NEIGHBORS];
+    uint8_t count = heat_find_neighbors(led, neighbors);
+    for (uint8_t k = 0; k < count; k++) {
+        heat_add(neighbors[k], SPARSE_HEATMAP_SPREAD_STEP);
+    }
+}
+
+// Cool every tracked key by the time passed, dropping keys that reached 0
+static void heat_cool(void) {
+    uint32_t elapsed = timer_elapsed32(heat_last_cool);
+    if (elapsed < SPARSE_HEATMAP_COOL_MS) {
+        return;
+    }
+    uint32_t units = elapsed / SPARSE_HEATMAP_COOL_MS;
+    heat_last_cool += units * SPARSE_HEATMAP_COOL_MS;
+    uint8_t cool = (units > UINT8_MAX) ? UINT8_MAX : units;
+
+    for (uint8_t i = 0; i < heat_count;) {
+        heat_keys[i].heat = qsub8(heat_keys[i].heat, cool);
+        if (heat_keys[i].heat == 0) {
+            heat_keys[i] = heat_keys[--heat_count];  // Order does not matter
+        } else {
+            i++;
+        }
+    }
+}
+
+bool rgb_effect_sparse_heatmap(effect_params_t *params) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    if (params->init) {
+        heat_count     = 0;
+        heat_last_cool = timer_read32();
+    }
+    if (params->iter == 0) {
+        heat_cool();
+    }
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        rgb_matrix_set_color(i, 0, 0, 0);
+    }
+
+    // Blue when barely used, red when hot, fading out as the key cools
+    HSV base = rgb_matrix_get_hsv();
+    for (uint8_t i = 0; i < heat_count; i++) {
+        uint8_t led = heat_keys[i].led;
+        if (led < led_min || led >= led_max || !HAS_ANY_FLAGS(g_led_config.flags[led], params->flags)) {
+            continue;
+        }
+        uint8_t heat = heat_keys[i].heat;
+        HSV     hsv  = {170 - scale8(170, heat), base.s, scale8(base.v, qadd8(heat, heat))};
+        RGB     rgb  = color_hsv_to_rgb(hsv);
+        rgb_matrix_set_color(led, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+// -----------------------------------------------------------------------------
+// Column Rain
+// -----------------------------------------------------------------------------
+
+// LED x is 0-224; one column per 16 units
+#define RAIN_COLUMNS 15
+#define RAIN_BOTTOM  64
+
+static struct {
+    int8_t  head;  // LED y of the drop head, negative while waiting to fall
+    uint8_t rate;  // y units per step
+} rain[RAIN_COLUMNS];
+
+static uint32_t rain_last_step;
+
+static void rain_restart(uint8_t col) {
+    rain[col].head = -(int8_t)(random8() & 63);
+    rain[col].rate = 2 + (random8() & 3);
+}
+
+static void rain_step(void) {
+    uint8_t  speed    = rgb_matrix_get_speed();
+    uint16_t interval = COLUMN_RAIN_STEP_MS_SLOW - scale8(COLUMN_RAIN_STEP_MS_SLOW - COLUMN_RAIN_STEP_MS_FAST, speed);
+    if (timer_elapsed32(rain_last_step) < interval) {
+        return;
+    }
+    rain_last_step = timer_read32();
+
+    for (uint8_t col = 0; col < RAIN_COLUMNS; col++) {
+        rain[col].head += rain[col].rate;
+        if (rain[col].head > RAIN_BOTTOM + COLUMN_RAIN_TRAIL) {
+            rain_restart(col);
+        }
+    }
+}
+
+bool rgb_effect_column_rain(effect_params_t *params) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+
+    if (params->init) {
+        for (uint8_t col = 0; col < RAIN_COLUMNS; col++) {
+            rain_restart(col);
+        }
+        rain_last_step = timer_read32();
+    }
+    if (params->iter == 0) {
+        rain_step();
+    }
+
+    HSV base = rgb_matrix_get_hsv();
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+        uint8_t col      = g_led_config.point[i].x / 16;
+        int16_t distance = rain[col < RAIN_COLUMNS ? col : RAIN_COLUMNS - 1].head - g_led_config.point[i].y;
+        if (distance < 0 || distance >= COLUMN_RAIN_TRAIL) {
+            rgb_matrix_set_color(i, 0, 0, 0);
+            continue;
+        }
+        // White-ish head, trail fading out in the effect color
+        uint8_t fade = 255 - (uint8_t)(distance * 255 / COLUMN_RAIN_TRAIL);
+        HSV     hsv  = {base.h, distance < 4 ? base.s / 4 : base.s, scale8(base.v, color_gamma8(fade))};
+        RGB     rgb  = color_hsv_to_rgb(hsv);
+        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+    }
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#endif // RGB_MATRIX_ENABLE && RGB_MATRIX_CUSTOM_USER
@@ -0,0 +1,64 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Userspace RGB matrix effects (registered in rgb_matrix_user.inc). Both keep
+// only small state of their own, so RGB_MATRIX_FRAMEBUFFER_EFFECTS (a
+// MATRIX_ROWS x MATRIX_COLS buffer) is not needed.
+//
+//   sparse_heatmap  Typing heatmap over a short list of recently heated keys
+//                   that cool down over time; a press also warms the keys
+//                   next to it, from a PROGMEM neighbor table generated into
+//                   mocklogic_led_map.h (or a search of g_led_config.point
+//                   without it)
+//   column_rain     Drops falling down LED columns, one head per column
+
+// Keys tracked by the sparse heatmap (the coolest one is replaced when full)
+#ifndef SPARSE_HEATMAP_KEYS
+#    define SPARSE_HEATMAP_KEYS 32
+#endif
+
+// Heat added per press to the key and to each of its neighbors, and time per
+// unit of cooling (255 units = fully hot)
+#ifndef SPARSE_HEATMAP_HEAT_STEP
+#    define SPARSE_HEATMAP_HEAT_STEP 32
+#endif
+#ifndef SPARSE_HEATMAP_SPREAD_STEP
+#    define SPARSE_HEATMAP_SPREAD_STEP 12
+#endif
+#ifndef SPARSE_HEATMAP_COOL_MS
+#    define SPARSE_HEATMAP_COOL_MS 25
+#endif
+
+// Neighbors per key: the closest key LEDs within the radius (LED units; keys
+// are about 15 apart horizontally and 13 vertically). tools/gen_led_map.py
+// reads these defaults for the generated table; override them in rules.mk,
+// which passes them to both. A table built for other values is not used.
+#ifndef SPARSE_HEATMAP_NEIGHBORS
+#    define SPARSE_HEATMAP_NEIGHBORS 4
+#endif
+#ifndef SPARSE_HEATMAP_SPREAD_RADIUS
+#    define SPARSE_HEATMAP_SPREAD_RADIUS 20
+#endif
+
+// Column rain: trail length in LED y units (the board is 64 units tall), and
+// the time between steps at the slowest and fastest effect speed
+#ifndef COLUMN_RAIN_TRAIL
+#    define COLUMN_RAIN_TRAIL 24
+#endif
+#ifndef COLUMN_RAIN_STEP_MS_SLOW
+#    define COLUMN_RAIN_STEP_MS_SLOW 120
+#endif
+#ifndef COLUMN_RAIN_STEP_MS_FAST
+#    define COLUMN_RAIN_STEP_MS_FAST 20
+#endif
+
+// Feed a key press to the sparse heatmap (ignored unless it is the active effect)
+void rgb_effects_key_pressed(keyrecord_t *record);
+
+// Effect renderers, called from rgb_matrix_user.inc
+bool rgb_effect_sparse_heatmap(effect_params_t *params);
+bool rgb_effect_column_rain(effect_params_t *params);
@@ -0,0 +1,49 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_governor.h"
+
+#ifdef RGB_MATRIX_ENABLE
+
+// Read by RGB_MATRIX_LED_FLUSH_LIMIT (see config.h) once per frame
+uint8_t rgb_frame_ms = RGB_FRAME_MS_ANIMATED;
+
+static uint8_t effect_frame_ms = RGB_FRAME_MS_ANIMATED;
+static bool    fast;
+static bool    frozen;
+
+static void update(void) {
+    if (fast) {
+        rgb_frame_ms = RGB_FRAME_MS_ANIMATED;
+    } else if (frozen) {
+        rgb_frame_ms = RGB_FRAME_MS_STATIC;
+    } else {
+        rgb_frame_ms = effect_frame_ms;
+    }
+}
+
+static uint8_t auto_frame_ms(uint8_t mode) {
+    switch (mode) {
+        case RGB_MATRIX_SOLID_COLOR:
+            return RGB_FRAME_MS_STATIC;
+        default:
+            return RGB_FRAME_MS_ANIMATED;
+    }
+}
+
+void rgb_governor_set_effect(uint8_t mode, uint8_t frame_ms) {
+    effect_frame_ms = (frame_ms == RGB_FRAME_MS_AUTO) ? auto_frame_ms(mode) : frame_ms;
+    update();
+}
+
+void rgb_governor_set_fast(bool enable) {
+    fast = enable;
+    update();
+}
+
+void rgb_governor_set_frozen(bool enable) {
+    frozen = enable;
+    update();
+}
+
+#endif // RGB_MATRIX_ENABLE
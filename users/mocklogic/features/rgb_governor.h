@@ -0,0 +1,33 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// RGB frame governor: config.h points RGB_MATRIX_LED_FLUSH_LIMIT at
+// rgb_frame_ms, so the render rate follows what is on screen instead of one
+// fixed rate for every effect. Static effects only need to pick up indicator
+// changes; animated and reactive effects get the full rate.
+
+// Frame time for animated/reactive effects (ms, ~60 fps)
+#ifndef RGB_FRAME_MS_ANIMATED
+#    define RGB_FRAME_MS_ANIMATED 16
+#endif
+
+// Frame time for static effects and frozen (idle) frames (ms)
+#ifndef RGB_FRAME_MS_STATIC
+#    define RGB_FRAME_MS_STATIC 100
+#endif
+
+// Preset frame time: pick by effect
+#define RGB_FRAME_MS_AUTO 0
+
+// Effect changed; frame_ms is the preset's rate or RGB_FRAME_MS_AUTO
+void rgb_governor_set_effect(uint8_t mode, uint8_t frame_ms);
+
+// Indicators animate on their own (e.g. the whack-a-mole game): full rate
+void rgb_governor_set_fast(bool fast);
+
+// Effect frozen by the idle manager: static rate
+void rgb_governor_set_frozen(bool frozen);
@@ -0,0 +1,103 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_idle.h"
+#include "scheduler.h"
+#include "rgb_governor.h"
+
+#ifdef RGB_MATRIX_ENABLE
+
+_Static_assert(RGB_IDLE_DIM_TIMEOUT < RGB_IDLE_STATIC_TIMEOUT && RGB_IDLE_STATIC_TIMEOUT < RGB_IDLE_OFF_TIMEOUT, "RGB idle timeouts must increase");
+
+typedef enum {
+    RGB_IDLE_ACTIVE,
+    RGB_IDLE_DIMMING,
+    RGB_IDLE_STATIC,
+    RGB_IDLE_OFF
+} rgb_idle_stage_t;
+
+static rgb_idle_stage_t stage = RGB_IDLE_ACTIVE;
+static uint32_t         last_activity;
+
+// Settings in effect before idling, restored on the next event
+static uint8_t saved_val;
+static uint8_t saved_mode;
+
+// Scheduler: advance through the stages. Keypresses only move last_activity,
+// so an early wake-up just sleeps again for the remaining time.
+static uint32_t rgb_idle_step(void) {
+    uint32_t idle = timer_elapsed32(last_activity);
+
+    switch (stage) {
+        case RGB_IDLE_ACTIVE:
+            if (idle < RGB_IDLE_DIM_TIMEOUT) {
+                return RGB_IDLE_DIM_TIMEOUT - idle;
+            }
+            if (!rgb_matrix_is_enabled()) {
+                return 0;  // Already dark; the next event re-arms
+            }
+            saved_val  = rgb_matrix_get_val();
+            saved_mode = rgb_matrix_get_mode();
+            stage       = RGB_IDLE_DIMMING;
+            // fall through
+        case RGB_IDLE_DIMMING:
+            if (idle < RGB_IDLE_STATIC_TIMEOUT) {
+                HSV     hsv   = rgb_matrix_get_hsv();
+                uint8_t floor = saved_val / RGB_IDLE_DIM_DIVISOR;
+                if (hsv.v <= floor) {
+                    return RGB_IDLE_STATIC_TIMEOUT - idle;
+                }
+                hsv.v = (hsv.v - floor > RGB_IDLE_DIM_STEP) ? hsv.v - RGB_IDLE_DIM_STEP : floor;
+                rgb_matrix_sethsv_noeeprom(hsv.h, hsv.s, hsv.v);
+                return RGB_IDLE_DIM_INTERVAL;
+            }
+            // Speed 0 does not stop every effect (RAINDROPS, column rain),
+            // a solid color of the same hue and brightness does
+            rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+            rgb_governor_set_frozen(true);
+            stage = RGB_IDLE_STATIC;
+            // fall through
+        case RGB_IDLE_STATIC:
+            if (idle < RGB_IDLE_OFF_TIMEOUT) {
+                return RGB_IDLE_OFF_TIMEOUT - idle;
+            }
+            rgb_matrix_disable_noeeprom();
+            stage = RGB_IDLE_OFF;
+            return 0;
+
+        case RGB_IDLE_OFF:
+        default:
+            return 0;
+    }
+}
+
+static void rgb_idle_restore(void) {
+    if (stage == RGB_IDLE_OFF) {
+        rgb_matrix_enable_noeeprom();
+    }
+    if (stage >= RGB_IDLE_STATIC) {
+        rgb_matrix_mode_noeeprom(saved_mode);
+        rgb_governor_set_frozen(false);
+    }
+    HSV hsv = rgb_matrix_get_hsv();
+    rgb_matrix_sethsv_noeeprom(hsv.h, hsv.s, saved_val);
+    stage = RGB_IDLE_ACTIVE;
+}
+
+void rgb_idle_init(void) {
+    scheduler_register(SCHED_RGB_IDLE, rgb_idle_step);
+    last_activity = timer_read32();
+    scheduler_wake_in(SCHED_RGB_IDLE, RGB_IDLE_DIM_TIMEOUT);
+}
+
+void rgb_idle_activity(void) {
+    last_activity = timer_read32();
+    if (stage != RGB_IDLE_ACTIVE) {
+        rgb_idle_restore();
+    }
+    if (!scheduler_is_pending(SCHED_RGB_IDLE)) {
+        scheduler_wake_in(SCHED_RGB_IDLE, RGB_IDLE_DIM_TIMEOUT);
+    }
+}
+
+#endif // RGB_MATRIX_ENABLE
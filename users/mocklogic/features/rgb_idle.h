@@ -0,0 +1,46 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// RGB idle manager: while the host is awake but nobody types, the LEDs step
+// down in stages instead of rendering at full brightness for hours:
+//
+//   ACTIVE -> DIMMING  brightness drops RGB_IDLE_DIM_STEP every
+//                      RGB_IDLE_DIM_INTERVAL down to 1/RGB_IDLE_DIM_DIVISOR
+//          -> STATIC   the effect gives way to a solid color of its hue, which
+//                      renders at the static frame rate (rgb_governor.h)
+//          -> OFF      RGB matrix disabled (not saved to EEPROM)
+//
+// Timeouts count from the last key or encoder event. The next event restores
+// brightness, effect and enable state at once. Only the RAM config is touched,
+// so EEPROM is never written by idling.
+
+// Idle time before each stage (ms)
+#ifndef RGB_IDLE_DIM_TIMEOUT
+#    define RGB_IDLE_DIM_TIMEOUT 60000
+#endif
+#ifndef RGB_IDLE_STATIC_TIMEOUT
+#    define RGB_IDLE_STATIC_TIMEOUT 300000
+#endif
+#ifndef RGB_IDLE_OFF_TIMEOUT
+#    define RGB_IDLE_OFF_TIMEOUT 900000
+#endif
+
+// Gradual dimming
+#ifndef RGB_IDLE_DIM_INTERVAL
+#    define RGB_IDLE_DIM_INTERVAL 1000
+#endif
+#ifndef RGB_IDLE_DIM_STEP
+#    define RGB_IDLE_DIM_STEP 8
+#endif
+#ifndef RGB_IDLE_DIM_DIVISOR
+#    define RGB_IDLE_DIM_DIVISOR 4
+#endif
+
+void rgb_idle_init(void);
+
+// Record user activity (cheap: a timestamp, plus a restore when idling)
+void rgb_idle_activity(void);
@@ -3,6 +3,11 @@
 
 #include "rgb_presets.h"
 #include "mocklogic.h"
+#include "rgb_governor.h"
+#include "color_math.h"
+#include "scheduler.h"
+#include "typing_stats.h"
+#include "perf.h"
 
 #ifdef RGB_MATRIX_ENABLE
 
@@ -12,14 +17,58 @@ typedef struct {
     uint8_t sat;
     uint8_t val;
     uint8_t speed;
+    uint8_t frame_ms;  // Render frame time, or RGB_FRAME_MS_AUTO to pick by effect
+    bool    speed_wpm; // Speed follows WPM, starting from speed at 0 WPM
 } rgb_preset_config_t;
 
+// Frame time for preset 4, whose effect is user-selected
+#ifndef RGB_PRESET_4_FRAME_MS
+#    define RGB_PRESET_4_FRAME_MS RGB_FRAME_MS_AUTO
+#endif
+
 // RGB config layer state - tracks changes during layer session
 static struct {
     bool active;
     rgb_preset_config_t temp_preset;
 } rgb_config_state;
 
+// Speed linked to WPM for the settings on screen
+static struct {
+    bool    active;
+    uint8_t base;  // Speed at 0 WPM
+} speed_link;
+
+// Scheduler: follow the WPM while typing; at 0 WPM settle on the base and
+// sleep until the next key press
+static uint32_t speed_link_step(void) {
+    if (!speed_link.active) {
+        return 0;
+    }
+    uint8_t wpm   = typing_stats_wpm();
+    uint8_t boost = (wpm >= RGB_WPM_SPEED_FULL) ? 255 : (uint16_t)wpm * 255 / RGB_WPM_SPEED_FULL;
+    rgb_matrix_set_speed_noeeprom(speed_link.base + scale8(255 - speed_link.base, boost));
+    return wpm ? RGB_WPM_SPEED_INTERVAL : 0;
+}
+
+static void speed_link_set(bool enabled, uint8_t base) {
+    speed_link.active = enabled;
+    speed_link.base   = base;
+    if (!enabled) {
+        scheduler_cancel(SCHED_RGB_WPM_SPEED);
+    }
+}
+
+void rgb_speed_link_activity(void) {
+    if (speed_link.active && !scheduler_is_pending(SCHED_RGB_WPM_SPEED)) {
+        scheduler_wake_in(SCHED_RGB_WPM_SPEED, RGB_WPM_SPEED_INTERVAL);
+    }
+}
+
+static void set_mode(uint8_t mode) {
+    PERF_COUNT(PERF_COUNT_RGB_MODE);
+    rgb_matrix_mode(mode);
+}
+
 // Define the first 3 RGB presets (hardcoded, not configurable)
 static const rgb_preset_config_t rgb_presets_fixed[] = {
     // Preset 0 (F5): No backlighting
@@ -28,7 +77,8 @@ static const rgb_preset_config_t rgb_presets_fixed[] = {
         .hue = 0,
         .sat = 0,
         .val = 0,
-        .speed = 0
+        .speed = 0,
+        .frame_ms = RGB_FRAME_MS_STATIC
     },
     // Preset 1 (F6): Dim warm white (default)
     {
@@ -36,7 +86,8 @@ static const rgb_preset_config_t rgb_presets_fixed[] = {
         .hue = 15,
         .sat = 40,
         .val = 60,
-        .speed = 0
+        .speed = 0,
+        .frame_ms = RGB_FRAME_MS_STATIC
     },
     // Preset 2 (F7): Bright warm white
     {
@@ -44,20 +95,45 @@ static const rgb_preset_config_t rgb_presets_fixed[] = {
         .hue = 15,
         .sat = 40,
         .val = 200,
-        .speed = 0
+        .speed = 0,
+        .frame_ms = RGB_FRAME_MS_STATIC
     }
 };
 
 // Default for Preset 3 (F8): Fun RGB reactive (loaded from EEPROM or this default)
 static const rgb_preset_config_t rgb_preset_4_default = {
-    .mode = RGB_MATRIX_TYPING_HEATMAP,
+    .mode = RGB_MATRIX_CUSTOM_sparse_heatmap,
     .hue = 0,
     .sat = 255,
     .val = 255,
-    .speed = RGB_MATRIX_SPD_STEP * 2  // Medium speed
+    .speed = RGB_MATRIX_SPD_STEP * 2,  // Medium speed
+    .frame_ms = RGB_PRESET_4_FRAME_MS
+};
+
+// Preset 4 modes saved before DIGITAL_RAIN and TYPING_HEATMAP gave way to
+// the userspace effects, by their old index in QMK's effect enum. Dropping
+// the framebuffer effects renumbered everything after RAINDROPS.
+static const uint8_t rgb_preset_mode_v1[] = {
+    [1] = RGB_MATRIX_SOLID_COLOR,
+    [2] = RGB_MATRIX_CYCLE_PINWHEEL,
+    [3] = RGB_MATRIX_RAINDROPS,
+    [4] = RGB_MATRIX_CUSTOM_sparse_heatmap,  // Was TYPING_HEATMAP
+    [5] = RGB_MATRIX_CUSTOM_column_rain,     // Was DIGITAL_RAIN
+    [6] = RGB_MATRIX_MULTISPLASH,
+    [7] = RGB_MATRIX_STARLIGHT_DUAL_HUE,
+    [8] = RGB_MATRIX_RIVERFLOW,
 };
 
 void rgb_preset_init(void) {
+    // Renumber a mode saved by an older firmware (unknown indices fall
+    // through to the default below)
+    if (!userspace_config.rgb_preset_mode_v2) {
+        uint8_t mode = userspace_config.rgb_preset_mode;
+        userspace_config.rgb_preset_mode    = mode < ARRAY_SIZE(rgb_preset_mode_v1) ? rgb_preset_mode_v1[mode] : RGB_MATRIX_EFFECT_MAX;
+        userspace_config.rgb_preset_mode_v2 = true;
+        userspace_config_save();
+    }
+
     // Validate 4th preset from EEPROM (already loaded by userspace_config_load)
     // Check if mode is invalid (>= max) or if it's a mode we disabled
     if (userspace_config.rgb_preset_mode >= RGB_MATRIX_EFFECT_MAX) {
@@ -72,6 +148,7 @@ void rgb_preset_init(void) {
 
     // Initialize config state as inactive
     rgb_config_state.active = false;
+    scheduler_register(SCHED_RGB_WPM_SPEED, speed_link_step);
 }
 
 void rgb_preset_apply(uint8_t preset) {
@@ -87,16 +164,21 @@ void rgb_preset_apply(uint8_t preset) {
     if (preset < 3) {
         // Presets 0-2: Use fixed presets
         const rgb_preset_config_t *config = &rgb_presets_fixed[preset];
-        rgb_matrix_mode(config->mode);
-        rgb_matrix_sethsv(config->hue, config->sat, config->val);
+        HSV hsv = color_trim_preset((HSV){config->hue, config->sat, config->val});
+        set_mode(config->mode);
+        rgb_matrix_sethsv(hsv.h, hsv.s, hsv.v);
         rgb_matrix_set_speed(config->speed);
+        rgb_governor_set_effect(config->mode, config->frame_ms);
+        speed_link_set(false, config->speed);
     } else {
         // Preset 3 (F8): Use custom preset from EEPROM
-        rgb_matrix_mode(userspace_config.rgb_preset_mode);
+        set_mode(userspace_config.rgb_preset_mode);
         rgb_matrix_sethsv(userspace_config.rgb_preset_hue,
                           userspace_config.rgb_preset_sat,
                           userspace_config.rgb_preset_val);
         rgb_matrix_set_speed(userspace_config.rgb_preset_speed);
+        rgb_governor_set_effect(userspace_config.rgb_preset_mode, rgb_preset_4_default.frame_ms);
+        speed_link_set(userspace_config.rgb_preset_speed_wpm, userspace_config.rgb_preset_speed);
     }
 }
 
@@ -110,6 +192,7 @@ void rgb_config_layer_enter(void) {
     rgb_config_state.temp_preset.sat = userspace_config.rgb_preset_sat;
     rgb_config_state.temp_preset.val = userspace_config.rgb_preset_val;
     rgb_config_state.temp_preset.speed = userspace_config.rgb_preset_speed;
+    rgb_config_state.temp_preset.speed_wpm = userspace_config.rgb_preset_speed_wpm;
 
     // If saturation is 0, use full saturation for color effects (avoid white/grayscale)
     if (rgb_config_state.temp_preset.sat == 0) {
@@ -118,11 +201,13 @@ void rgb_config_layer_enter(void) {
 
     // Apply preset 4 (using temp settings)
     rgb_matrix_enable();
-    rgb_matrix_mode(rgb_config_state.temp_preset.mode);
+    set_mode(rgb_config_state.temp_preset.mode);
     rgb_matrix_sethsv(rgb_config_state.temp_preset.hue,
                       rgb_config_state.temp_preset.sat,
                       rgb_config_state.temp_preset.val);
     rgb_matrix_set_speed(rgb_config_state.temp_preset.speed);
+    rgb_governor_set_effect(rgb_config_state.temp_preset.mode, rgb_preset_4_default.frame_ms);
+    speed_link_set(rgb_config_state.temp_preset.speed_wpm, rgb_config_state.temp_preset.speed);
 }
 
 // Exit RGB config layer - save settings to EEPROM and preset 4
@@ -135,6 +220,7 @@ void rgb_config_layer_exit(void) {
     userspace_config.rgb_preset_sat = rgb_config_state.temp_preset.sat;
     userspace_config.rgb_preset_val = rgb_config_state.temp_preset.val;
     userspace_config.rgb_preset_speed = rgb_config_state.temp_preset.speed;
+    userspace_config.rgb_preset_speed_wpm = rgb_config_state.temp_preset.speed_wpm;
     userspace_config_save();
 
     rgb_config_state.active = false;
@@ -152,13 +238,16 @@ void rgb_config_layer_reset(void) {
     rgb_config_state.temp_preset.sat = userspace_config.rgb_preset_sat;
     rgb_config_state.temp_preset.val = userspace_config.rgb_preset_val;
     rgb_config_state.temp_preset.speed = userspace_config.rgb_preset_speed;
+    rgb_config_state.temp_preset.speed_wpm = userspace_config.rgb_preset_speed_wpm;
 
     // Reapply
-    rgb_matrix_mode(rgb_config_state.temp_preset.mode);
+    set_mode(rgb_config_state.temp_preset.mode);
     rgb_matrix_sethsv(rgb_config_state.temp_preset.hue,
                       rgb_config_state.temp_preset.sat,
                       rgb_config_state.temp_preset.val);
     rgb_matrix_set_speed(rgb_config_state.temp_preset.speed);
+    rgb_governor_set_effect(rgb_config_state.temp_preset.mode, rgb_preset_4_default.frame_ms);
+    speed_link_set(rgb_config_state.temp_preset.speed_wpm, rgb_config_state.temp_preset.speed);
 }
 
 // Set RGB effect mode
@@ -166,7 +255,8 @@ void rgb_config_set_effect(uint8_t mode) {
     if (!rgb_config_state.active) return;
 
     rgb_config_state.temp_preset.mode = mode;
-    rgb_matrix_mode(mode);
+    set_mode(mode);
+    rgb_governor_set_effect(mode, rgb_preset_4_default.frame_ms);
 }
 
 // Adjust hue (encoder rotation)
@@ -222,6 +312,20 @@ void rgb_config_adjust_speed(int8_t delta) {
 
     rgb_config_state.temp_preset.speed = (uint8_t)new_speed;
     rgb_matrix_set_speed(rgb_config_state.temp_preset.speed);
+    speed_link.base = rgb_config_state.temp_preset.speed;  // Arrows set the speed at 0 WPM
+}
+
+// Link speed to WPM (toggle)
+void rgb_config_toggle_speed_wpm(void) {
+    if (!rgb_config_state.active) return;
+
+    rgb_config_state.temp_preset.speed_wpm = !rgb_config_state.temp_preset.speed_wpm;
+    speed_link_set(rgb_config_state.temp_preset.speed_wpm, rgb_config_state.temp_preset.speed);
+    rgb_matrix_set_speed_noeeprom(rgb_config_state.temp_preset.speed);
+}
+
+bool rgb_config_speed_wpm_enabled(void) {
+    return speed_link.active;
 }
 
 #endif // RGB_MATRIX_ENABLE
@@ -4,6 +4,16 @@
 #pragma once
 #include QMK_KEYBOARD_H
 
+// Preset 4 can link its effect speed to typing speed: the saved speed applies
+// at 0 WPM and rises to full speed at RGB_WPM_SPEED_FULL WPM. While typing,
+// the speed is refreshed every RGB_WPM_SPEED_INTERVAL ms.
+#ifndef RGB_WPM_SPEED_FULL
+#    define RGB_WPM_SPEED_FULL 120
+#endif
+#ifndef RGB_WPM_SPEED_INTERVAL
+#    define RGB_WPM_SPEED_INTERVAL 250
+#endif
+
 // RGB preset configuration
 void rgb_preset_init(void);
 void rgb_preset_apply(uint8_t preset);
@@ -17,3 +27,8 @@ void rgb_config_adjust_hue(int8_t delta);
 void rgb_config_adjust_sat(int8_t delta);
 void rgb_config_adjust_val(int8_t delta);
 void rgb_config_adjust_speed(int8_t delta);
+void rgb_config_toggle_speed_wpm(void);
+bool rgb_config_speed_wpm_enabled(void);
+
+// Key press: resume WPM speed updates if linked (called from process_record_user)
+void rgb_speed_link_activity(void);
@@ -0,0 +1,155 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "scheduler.h"
+
+#define NOT_QUEUED 0xFF
+
+static scheduler_callback_t callbacks[SCHED_TASK_COUNT];
+static uint32_t             deadlines[SCHED_TASK_COUNT];
+static uint8_t              heap_pos[SCHED_TASK_COUNT] = {[0 ... SCHED_TASK_COUNT - 1] = NOT_QUEUED};
+
+// Min-heap of task IDs ordered by deadline
+static uint8_t heap[SCHED_TASK_COUNT];
+static uint8_t heap_size;
+
+static deferred_token token = INVALID_DEFERRED_TOKEN;
+static bool           dispatching;
+
+// Wrap-safe "a is earlier than b" for 32-bit timer values
+static inline bool before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+static void heap_swap(uint8_t i, uint8_t j) {
+    uint8_t t = heap[i];
+    heap[i] = heap[j];
+    heap[j] = t;
+    heap_pos[heap[i]] = i;
+    heap_pos[heap[j]] = j;
+}
+
+static void sift_up(uint8_t i) {
+    while (i > 0) {
+        uint8_t parent = (i - 1) / 2;
+        if (!before(deadlines[heap[i]], deadlines[heap[parent]])) {
+            break;
+        }
+        heap_swap(i, parent);
+        i = parent;
+    }
+}
+
+static void sift_down(uint8_t i) {
+    for (;;) {
+        uint8_t smallest = i;
+        uint8_t left = 2 * i + 1;
+        uint8_t right = left + 1;
+        if (left < heap_size && before(deadlines[heap[left]], deadlines[heap[smallest]])) {
+            smallest = left;
+        }
+        if (right < heap_size && before(deadlines[heap[right]], deadlines[heap[smallest]])) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            break;
+        }
+        heap_swap(i, smallest);
+        i = smallest;
+    }
+}
+
+static void heap_remove(scheduler_task_t task) {
+    uint8_t i = heap_pos[task];
+    heap_pos[task] = NOT_QUEUED;
+    heap_size--;
+    if (i == heap_size) {
+        return;
+    }
+    // Move the last entry into the hole and restore heap order around it
+    uint8_t moved = heap[heap_size];
+    heap[i] = moved;
+    heap_pos[moved] = i;
+    sift_up(i);
+    sift_down(heap_pos[moved]);
+}
+
+static void heap_push(scheduler_task_t task, uint32_t deadline) {
+    deadlines[task] = deadline;
+    heap[heap_size] = task;
+    heap_pos[task] = heap_size;
+    heap_size++;
+    sift_up(heap_size - 1);
+}
+
+// Time until the earliest deadline (at least 1ms, as 0 would stop the executor)
+static uint32_t next_delay(void) {
+    uint32_t now = timer_read32();
+    uint32_t deadline = deadlines[heap[0]];
+    return before(now, deadline) ? deadline - now : 1;
+}
+
+static uint32_t scheduler_dispatch(uint32_t trigger_time, void *cb_arg) {
+    (void)trigger_time;
+    (void)cb_arg;
+
+    dispatching = true;
+    uint32_t now = timer_read32();
+    while (heap_size > 0 && !before(now, deadlines[heap[0]])) {
+        scheduler_task_t task = heap[0];
+        heap_remove(task);
+
+        uint32_t next = callbacks[task] ? callbacks[task]() : 0;
+        if (next > 0 && heap_pos[task] == NOT_QUEUED) {
+            heap_push(task, now + next);
+        }
+    }
+    dispatching = false;
+
+    if (heap_size == 0) {
+        token = INVALID_DEFERRED_TOKEN;
+        return 0;
+    }
+    return next_delay();
+}
+
+// Point the deferred executor at the earliest deadline
+static void arm(void) {
+    if (dispatching) {
+        return;  // scheduler_dispatch() rearms on return
+    }
+    if (heap_size == 0) {
+        if (token != INVALID_DEFERRED_TOKEN) {
+            cancel_deferred_exec(token);
+            token = INVALID_DEFERRED_TOKEN;
+        }
+        return;
+    }
+    if (token == INVALID_DEFERRED_TOKEN || !extend_deferred_exec(token, next_delay())) {
+        token = defer_exec(next_delay(), scheduler_dispatch, NULL);
+    }
+}
+
+void scheduler_register(scheduler_task_t task, scheduler_callback_t callback) {
+    callbacks[task] = callback;
+}
+
+void scheduler_wake_in(scheduler_task_t task, uint32_t delay_ms) {
+    if (heap_pos[task] != NOT_QUEUED) {
+        heap_remove(task);
+    }
+    heap_push(task, timer_read32() + delay_ms);
+    arm();
+}
+
+void scheduler_cancel(scheduler_task_t task) {
+    if (heap_pos[task] == NOT_QUEUED) {
+        return;
+    }
+    heap_remove(task);
+    arm();
+}
+
+bool scheduler_is_pending(scheduler_task_t task) {
+    return heap_pos[task] != NOT_QUEUED;
+}
@@ -0,0 +1,33 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Userspace timed work. Each feature owns one task slot; a min-heap of
+// deadlines drives a single QMK deferred executor, so nothing runs (or
+// polls the timer) between deadlines.
+typedef enum {
+    SCHED_JIGGLER,            // Mouse jiggler nudge
+    SCHED_AUTOCORRECT_STATS,  // Lazy flush of autocorrect hit counters
+    SCHED_RGB_IDLE,           // RGB idle dimming / power-down steps
+    SCHED_KEY_USAGE,          // Batched flush of per-key press counters
+    SCHED_RGB_WPM_SPEED,      // Effect speed following WPM while typing
+    SCHED_TASK_COUNT
+} scheduler_task_t;
+
+// Task callback: return the delay until the next run (ms), or 0 to stop
+typedef uint32_t (*scheduler_callback_t)(void);
+
+// Set the callback for a task (safe to call again, e.g. from a feature init)
+void scheduler_register(scheduler_task_t task, scheduler_callback_t callback);
+
+// Run the task in delay_ms, replacing any pending deadline
+void scheduler_wake_in(scheduler_task_t task, uint32_t delay_ms);
+
+// Drop a pending deadline (no-op if not scheduled)
+void scheduler_cancel(scheduler_task_t task);
+
+// Check if a task has a pending deadline
+bool scheduler_is_pending(scheduler_task_t task);
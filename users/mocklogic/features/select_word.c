@@ -18,89 +18,222 @@
 
 #include "select_word.h"
 #include "mocklogic.h"  // For layer definitions
+#include "multi_tap.h"
+#include "perf.h"
 
-// Runtime OS detection: Check if Mac base layer (layer 0) is active
-#define IS_MAC_MODE() (get_highest_layer(default_layer_state) == _MAC_BASE)
+// OS-specific editing hotkeys, resolved once when the host OS changes rather
+// than on every event.
+typedef struct {
+  uint8_t word_mods;   // Jump by word or paragraph (Ctrl / Option).
+  uint8_t line_mods;   // Mods for the jump to line start/end keys.
+  uint8_t line_start;  // Home / Ctrl+A.
+  uint8_t line_end;    // End / Ctrl+E.
+} select_word_hotkeys_t;
 
-enum { STATE_NONE, STATE_SELECTED, STATE_WORD, STATE_FIRST_LINE, STATE_LINE };
+static const select_word_hotkeys_t hotkeys_win = {
+    .word_mods = MOD_BIT(KC_LCTL),
+    .line_mods = 0,
+    .line_start = KC_HOME,
+    .line_end = KC_END,
+};
+
+static const select_word_hotkeys_t hotkeys_mac = {
+    .word_mods = MOD_BIT(KC_LALT),
+    .line_mods = MOD_BIT(KC_LCTL),
+    .line_start = KC_A,
+    .line_end = KC_E,
+};
+
+typedef struct {
+  uint8_t mods;
+  uint8_t key;
+} hotkey_t;
+
+// Key sequence for one selection unit in one direction.
+typedef struct {
+  hotkey_t start[3];  // Anchor and select the first unit (KC_NO = unused).
+  hotkey_t extend;    // Extend the selection by one more unit.
+} select_unit_t;
+
+enum { UNIT_WORD, UNIT_LINE, UNIT_PARAGRAPH, NUM_UNITS };
+enum { STATE_NONE, STATE_SELECTED, STATE_HELD };
+
+// [unit][reverse], filled in by select_word_set_mac_mode().
+static select_unit_t units[NUM_UNITS][2];
+
+static struct {
+  uint8_t state;
+  uint8_t unit;
+  bool reverse;
+  multi_tap_t taps;         // Presses in a row within SELECT_WORD_TAP_TERM.
+  uint8_t saved_mods;       // Physical user mods, restored on release.
+  deferred_token repeat;    // Auto-repeat while the button is held.
+} sel;
+
+static hotkey_t hk(uint8_t mods, uint8_t key) {
+  return (hotkey_t){mods, key};
+}
+
+void select_word_set_mac_mode(bool is_mac) {
+  const select_word_hotkeys_t* os = is_mac ? &hotkeys_mac : &hotkeys_win;
+  const uint8_t w = os->word_mods;
+  const uint8_t l = os->line_mods;
+  const uint8_t sh = MOD_BIT(KC_LSFT);
+
+  // Word: jump past the word and back to anchor at its edge, then select.
+  units[UNIT_WORD][0] = (select_unit_t){
+      {hk(w, KC_RGHT), hk(w, KC_LEFT), hk(w | sh, KC_RGHT)}, hk(w | sh, KC_RGHT)};
+  units[UNIT_WORD][1] = (select_unit_t){
+      {hk(w, KC_LEFT), hk(w, KC_RGHT), hk(w | sh, KC_LEFT)}, hk(w | sh, KC_LEFT)};
+
+  // Line: jump to one end of the line and select to the other.
+  units[UNIT_LINE][0] = (select_unit_t){
+      {hk(l, os->line_start), hk(l | sh, os->line_end), hk(0, KC_NO)}, hk(sh, KC_DOWN)};
+  units[UNIT_LINE][1] = (select_unit_t){
+      {hk(l, os->line_end), hk(l | sh, os->line_start), hk(0, KC_NO)}, hk(sh, KC_UP)};
+
+  // Paragraph: same anchoring trick as words, using the word mods + Up/Down.
+  units[UNIT_PARAGRAPH][0] = (select_unit_t){
+      {hk(w, KC_DOWN), hk(w, KC_UP), hk(w | sh, KC_DOWN)}, hk(w | sh, KC_DOWN)};
+  units[UNIT_PARAGRAPH][1] = (select_unit_t){
+      {hk(w, KC_UP), hk(w, KC_DOWN), hk(w | sh, KC_UP)}, hk(w | sh, KC_UP)};
+}
+
+// Taps `keycode` with exactly `mods` applied. The mod change rides along with
+// the key press, so each tap costs two HID reports instead of four or more.
+static void tap_with_mods(uint8_t mods, uint8_t keycode) {
+  set_mods(mods);
+  add_key(keycode);
+  PERF_COUNT(PERF_COUNT_HID_REPORTS);
+  send_keyboard_report();
+  del_key(keycode);
+  PERF_COUNT(PERF_COUNT_HID_REPORTS);
+  send_keyboard_report();
+}
+
+static const select_unit_t* current_unit(void) {
+  return &units[sel.unit][sel.reverse];
+}
+
+static void start_selection(void) {
+  const select_unit_t* u = current_unit();
+  for (uint8_t i = 0; i < 3 && u->start[i].key != KC_NO; i++) {
+    tap_with_mods(u->start[i].mods, u->start[i].key);
+  }
+}
+
+static void extend_selection(void) {
+  const select_unit_t* u = current_unit();
+  tap_with_mods(u->extend.mods, u->extend.key);
+}
+
+// Auto-repeat driven by the keyboard instead of the host's key repeat, so
+// the rate is fixed and each step is exactly one tap.
+static uint32_t repeat_callback(uint32_t trigger_time, void* cb_arg) {
+  extend_selection();
+  return SELECT_WORD_REPEAT_INTERVAL;
+}
+
+// Ends a hold: stops auto-repeat and restores the user's mods.
+static void release_hold(void) {
+  if (sel.repeat != INVALID_DEFERRED_TOKEN) {
+    cancel_deferred_exec(sel.repeat);
+    sel.repeat = INVALID_DEFERRED_TOKEN;
+  }
+  set_mods(sel.saved_mods);
+  PERF_COUNT(PERF_COUNT_HID_REPORTS);
+  send_keyboard_report();
+  sel.state = STATE_SELECTED;
+}
 
 bool process_select_word(uint16_t keycode, keyrecord_t* record,
                          uint16_t sel_keycode) {
-  static uint8_t state = STATE_NONE;
+  PERF_SCOPE(PERF_SELECT_WORD);
 
-  if (keycode == KC_LSFT || keycode == KC_RSFT) { return true; }
+  // Modifiers choose line/reverse selection, so they never reset the state.
+  if (IS_MODIFIER_KEYCODE(keycode)) {
+    if (sel.state == STATE_HELD) {
+      // The extend mods own the report during a hold. Track the physical
+      // mods instead, so release_hold() restores only what is still held.
+      if (record->event.pressed) {
+        sel.saved_mods |= MOD_BIT(keycode);
+      } else {
+        sel.saved_mods &= ~MOD_BIT(keycode);
+      }
+      return false;
+    }
+    return true;
+  }
 
   if (keycode == sel_keycode && record->event.pressed) {  // On key press.
     const uint8_t mods = get_mods();
 #ifndef NO_ACTION_ONESHOT
     const uint8_t all_mods = mods | get_oneshot_mods();
+    clear_oneshot_mods();
 #else
     const uint8_t all_mods = mods;
 #endif  // NO_ACTION_ONESHOT
-    if ((all_mods & MOD_MASK_SHIFT) == 0) {  // Select word.
-      if (IS_MAC_MODE()) {
-        register_code(KC_LALT);
-      } else {
-        register_code(KC_LCTL);
-      }
-      if (state == STATE_NONE) {
-        SEND_STRING(SS_TAP(X_RGHT) SS_TAP(X_LEFT));
-      }
-      register_code(KC_LSFT);
-      register_code(KC_RGHT);
-      state = STATE_WORD;
-    } else {  // Select line.
-      if (state == STATE_NONE) {
-        clear_mods();
-#ifndef NO_ACTION_ONESHOT
-        clear_oneshot_mods();
-#endif  // NO_ACTION_ONESHOT
-        if (IS_MAC_MODE()) {
-          SEND_STRING(SS_LCTL("a" SS_LSFT("e")));
-        } else {
-          SEND_STRING(SS_TAP(X_HOME) SS_LSFT(SS_TAP(X_END)));
-        }
-        set_mods(mods);
-        state = STATE_FIRST_LINE;
-      } else {
-        register_code(KC_DOWN);
-        state = STATE_LINE;
-      }
+    const bool reverse = (all_mods & SELECT_WORD_REVERSE_MODS) != 0;
+    uint8_t unit = (all_mods & MOD_MASK_SHIFT) ? UNIT_LINE : UNIT_WORD;
+
+    if (sel.state == STATE_HELD) {  // Missed release; finish the old hold.
+      release_hold();
+    }
+    sel.saved_mods = mods;
+
+    if (sel.state != STATE_SELECTED) {
+      multi_tap_reset(&sel.taps);
+    }
+    const uint8_t tap_count =
+        multi_tap_press(&sel.taps, record->event.time, SELECT_WORD_TAP_TERM);
+
+    // Keep extending by paragraph once one is selected.
+    if (unit == UNIT_WORD && sel.state == STATE_SELECTED &&
+        sel.unit == UNIT_PARAGRAPH) {
+      unit = UNIT_PARAGRAPH;
+    }
+
+    if (unit == UNIT_WORD && tap_count == 3) {
+      // Triple press: replace the word selection with the paragraph.
+      sel.unit = UNIT_PARAGRAPH;
+      sel.reverse = reverse;
+      start_selection();
+    } else if (sel.state == STATE_NONE || sel.unit != unit ||
+               sel.reverse != reverse) {
+      sel.unit = unit;
+      sel.reverse = reverse;
+      start_selection();
+    } else {
+      extend_selection();
     }
+
+    // Hold the extend mods so each auto-repeat step is a bare key tap.
+    set_mods(current_unit()->extend.mods);
+    sel.repeat = defer_exec(SELECT_WORD_REPEAT_DELAY, repeat_callback, NULL);
+    sel.state = STATE_HELD;
     return false;
   }
 
   // `sel_keycode` was released, or another key was pressed.
-  switch (state) {
-    case STATE_WORD:
-      unregister_code(KC_RGHT);
-      unregister_code(KC_LSFT);
-      if (IS_MAC_MODE()) {
-        unregister_code(KC_LALT);
-      } else {
-        unregister_code(KC_LCTL);
-      }
-      state = STATE_SELECTED;
-      break;
-
-    case STATE_FIRST_LINE:
-      state = STATE_SELECTED;
-      break;
-
-    case STATE_LINE:
-      unregister_code(KC_DOWN);
-      state = STATE_SELECTED;
+  switch (sel.state) {
+    case STATE_HELD:
+      release_hold();
       break;
 
     case STATE_SELECTED:
-      if (keycode == KC_ESC) {
-        tap_code(KC_RGHT);
-        state = STATE_NONE;
+      if (keycode == KC_ESC && record->event.pressed) {
+        // Collapse the selection at its moving end.
+        tap_code(sel.reverse ? KC_LEFT : KC_RGHT);
+        sel.state = STATE_NONE;
         return false;
       }
-      // Fallthrough.
+      if (record->event.pressed) {
+        sel.state = STATE_NONE;
+      }
+      break;
+
     default:
-      state = STATE_NONE;
+      break;
   }
 
   return true;
@@ -22,9 +22,15 @@
 // Pressing the button with shift selects the current line, and pressing the
 // button again extends the selection to the following line.
 //
-// Note for Mac users: Windows/Linux editing hotkeys are assumed by default.
-// Uncomment the `#define MAC_HOTKEYS` line in select_word.c for Mac hotkeys.
-// The Mac implementation is untested, let me know if it has problems.
+// Holding SELECT_WORD_REVERSE_MODS (Alt/Option by default) selects and
+// extends backwards instead. Pressing the button three times in quick
+// succession selects the current paragraph. Holding the button auto-repeats
+// the extension at SELECT_WORD_REPEAT_INTERVAL using deferred execution, so
+// the rate does not depend on the host's key repeat settings.
+//
+// Mac or Windows/Linux editing hotkeys are chosen with
+// select_word_set_mac_mode(), which the userspace calls whenever the host
+// profile (features/host_profile.h) changes.
 //
 // For full documentation, see
 // https://getreuer.info/posts/keyboards/select-word
@@ -33,5 +39,26 @@
 
 #include QMK_KEYBOARD_H
 
+// Mods that make selection go backwards.
+#ifndef SELECT_WORD_REVERSE_MODS
+#define SELECT_WORD_REVERSE_MODS MOD_MASK_ALT
+#endif
+
+// Window for counting repeated presses (triple press selects a paragraph).
+#ifndef SELECT_WORD_TAP_TERM
+#define SELECT_WORD_TAP_TERM TAPPING_TERM
+#endif
+
+// Hold time before auto-repeat starts, and time between repeats (ms).
+#ifndef SELECT_WORD_REPEAT_DELAY
+#define SELECT_WORD_REPEAT_DELAY 400
+#endif
+#ifndef SELECT_WORD_REPEAT_INTERVAL
+#define SELECT_WORD_REPEAT_INTERVAL 80
+#endif
+
 bool process_select_word(uint16_t keycode, keyrecord_t* record,
                          uint16_t sel_keycode);
+
+// Selects the hotkey table used by process_select_word().
+void select_word_set_mac_mode(bool is_mac);
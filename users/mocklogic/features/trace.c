@@ -0,0 +1,75 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "trace.h"
+
+#ifdef MOCKLOGIC_TRACE_ENABLE
+
+_Static_assert(MATRIX_ROWS <= 16 && MATRIX_COLS <= 32, "Matrix does not fit the trace format");
+
+static uint8_t  events[TRACE_EVENTS][3];
+static uint16_t head;   // Next slot to write
+static uint16_t count;
+static uint32_t last_event;
+
+void trace_record(keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event)) {
+        return;  // Encoder and combo events have no matrix position
+    }
+    uint32_t now   = timer_read32();
+    uint32_t delta = count ? now - last_event : 0;
+    last_event     = now;
+    if (delta > TRACE_MAX_DELTA) {
+        delta = TRACE_MAX_DELTA;
+    }
+
+    uint32_t word = record->event.key.col | (uint32_t)record->event.key.row << 5 | (uint32_t)record->event.pressed << 9 | delta << 10;
+    events[head][0] = word;
+    events[head][1] = word >> 8;
+    events[head][2] = word >> 16;
+
+    head = (head + 1) % TRACE_EVENTS;
+    if (count < TRACE_EVENTS) {
+        count++;
+    }
+}
+
+// Number without get_numeric_str()'s padding, so the header is "trace 1 256"
+static void send_number(uint16_t n) {
+    char        buf[6];
+    const char *digits = get_numeric_str(buf, sizeof(buf), n, ' ');
+    while (*digits == ' ') {
+        digits++;
+    }
+    send_string(digits);
+}
+
+void trace_dump(void) {
+    static const char hex[] = "0123456789abcdef";
+
+    send_string("trace ");
+    send_number(TRACE_VERSION);
+    send_char(' ');
+    send_number(count);
+    send_char('\n');
+
+    uint16_t index = (head + TRACE_EVENTS - count) % TRACE_EVENTS;
+    uint8_t  column = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        for (uint8_t b = 0; b < 3; b++) {
+            send_char(hex[events[index][b] >> 4]);
+            send_char(hex[events[index][b] & 0xF]);
+            if (++column == 32) {
+                send_char('\n');
+                column = 0;
+            }
+        }
+        index = (index + 1) % TRACE_EVENTS;
+    }
+    if (column) {
+        send_char('\n');
+    }
+    send_string("end\n");
+}
+
+#endif // MOCKLOGIC_TRACE_ENABLE
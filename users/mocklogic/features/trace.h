@@ -0,0 +1,42 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Key event recorder for reproducing bugs and timing regressions. Build with
+// MOCKLOGIC_TRACE_ENABLE = yes (see rules.mk): every key event reaching
+// process_record_user() is appended to a RAM ring buffer, and Leader + TRACE
+// types the buffer as hex for tools/trace_decode.py.
+//
+// Each event is 3 bytes, a little-endian 24-bit word:
+//
+//   bits  0-4   column
+//   bits  5-8   row
+//   bit   9     pressed
+//   bits 10-23  ms since the previous event (saturates at TRACE_MAX_DELTA)
+//
+// Typed as:
+//
+//   trace 1 <event count>
+//   <hex, 32 bytes per line, oldest event first>
+//   end
+
+#define TRACE_VERSION   1
+#define TRACE_MAX_DELTA 0x3FFF
+
+// Events kept (the oldest is overwritten when full)
+#ifndef TRACE_EVENTS
+    #define TRACE_EVENTS 256
+#endif
+
+#ifdef MOCKLOGIC_TRACE_ENABLE
+
+// Append a key event (called first thing in process_record_user)
+void trace_record(keyrecord_t *record);
+
+// Type the buffer in the format above
+void trace_dump(void);
+
+#endif // MOCKLOGIC_TRACE_ENABLE
@@ -0,0 +1,118 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "typing_stats.h"
+
+_Static_assert((TYPING_STATS_RING_SIZE & (TYPING_STATS_RING_SIZE - 1)) == 0, "TYPING_STATS_RING_SIZE must be a power of two");
+_Static_assert(TYPING_STATS_BUCKETS >= 2 && TYPING_STATS_BUCKETS <= 17, "TYPING_STATS_BUCKETS out of range");
+
+// Press-to-press intervals of the current typing, and their sum
+static uint16_t ring[TYPING_STATS_RING_SIZE];
+static uint8_t  ring_head;
+static uint8_t  ring_count;
+static uint32_t ring_sum;
+
+static uint32_t last_press;
+static bool     have_last_press;
+
+// Saturating counters per log2 bucket
+static uint16_t interval_histogram[TYPING_STATS_BUCKETS];
+static uint16_t hold_histogram[TYPING_STATS_BUCKETS];
+
+// Keys currently down, for hold times
+static struct {
+    keypos_t key;
+    uint32_t time;
+    bool     used;
+} held[TYPING_STATS_MAX_HELD];
+
+static void histogram_add(uint16_t *histogram, uint32_t ms) {
+    uint8_t bucket = ms ? 32 - __builtin_clz(ms) : 0;  // Bit length: one CLZ
+    if (bucket >= TYPING_STATS_BUCKETS) {
+        bucket = TYPING_STATS_BUCKETS - 1;
+    }
+    if (histogram[bucket] < UINT16_MAX) {
+        histogram[bucket]++;
+    }
+}
+
+static void record_press(keyrecord_t *record, uint32_t now) {
+    if (have_last_press) {
+        uint32_t interval = now - last_press;
+        histogram_add(interval_histogram, interval);
+
+        if (interval <= TYPING_STATS_PAUSE_MS) {
+            if (ring_count == TYPING_STATS_RING_SIZE) {
+                ring_sum -= ring[ring_head];
+            } else {
+                ring_count++;
+            }
+            ring[ring_head] = interval;
+            ring_sum += interval;
+            ring_head = (ring_head + 1) & (TYPING_STATS_RING_SIZE - 1);
+        }
+    }
+    last_press      = now;
+    have_last_press = true;
+
+    for (uint8_t i = 0; i < TYPING_STATS_MAX_HELD; i++) {
+        if (!held[i].used) {
+            held[i].key  = record->event.key;
+            held[i].time = now;
+            held[i].used = true;
+            return;
+        }
+    }
+    // More keys down than tracked: this one's hold time is not measured
+}
+
+static void record_release(keyrecord_t *record, uint32_t now) {
+    for (uint8_t i = 0; i < TYPING_STATS_MAX_HELD; i++) {
+        if (held[i].used && KEYEQ(held[i].key, record->event.key)) {
+            histogram_add(hold_histogram, now - held[i].time);
+            held[i].used = false;
+            return;
+        }
+    }
+}
+
+void typing_stats_record(keyrecord_t *record) {
+    if (!IS_KEYEVENT(record->event)) {
+        return;
+    }
+    uint32_t now = timer_read32();
+    if (record->event.pressed) {
+        record_press(record, now);
+    } else {
+        record_release(record, now);
+    }
+}
+
+uint8_t typing_stats_wpm(void) {
+    if (ring_count == 0 || ring_sum == 0 || timer_elapsed32(last_press) > TYPING_STATS_PAUSE_MS) {
+        return 0;
+    }
+    // 60000 ms per minute / (average interval * 5 characters per word)
+    uint32_t wpm = 12000UL * ring_count / ring_sum;
+    return (wpm > UINT8_MAX) ? UINT8_MAX : wpm;
+}
+
+static void dump_histogram(const char *name, const uint16_t *histogram) {
+    for (uint8_t bucket = 0; bucket < TYPING_STATS_BUCKETS; bucket++) {
+        if (histogram[bucket] == 0) {
+            continue;
+        }
+        send_string(name);
+        send_string(get_u16_str(bucket ? 1U << (bucket - 1) : 0, ' '));
+        send_string(get_u16_str(histogram[bucket], ' '));
+        send_char('\n');
+    }
+}
+
+void typing_stats_dump(void) {
+    send_string("wpm ");
+    send_string(get_u8_str(typing_stats_wpm(), ' '));
+    send_char('\n');
+    dump_histogram("int ", interval_histogram);
+    dump_histogram("hold", hold_histogram);
+}
@@ -0,0 +1,44 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Typing speed and timing statistics, for tuning TAPPING_TERM and the leader
+// timeout. Every press adds its gap to the previous press to a ring buffer
+// with a running sum, and to a log2 histogram; every release adds the key's
+// hold time to a second histogram. Recording does no division: WPM is
+// derived from the running sum only when read.
+
+// Intervals kept for the running WPM (power of two)
+#ifndef TYPING_STATS_RING_SIZE
+    #define TYPING_STATS_RING_SIZE 32
+#endif
+
+// Gaps longer than this are pauses: they go to the histogram but not the ring,
+// and WPM reads 0 once the last press is this old (ms)
+#ifndef TYPING_STATS_PAUSE_MS
+    #define TYPING_STATS_PAUSE_MS 2000
+#endif
+
+// Histogram buckets: 0 ms, 1 ms, 2-3 ms, 4-7 ms, ... with the last bucket
+// open-ended (1024+ ms for 12 buckets)
+#ifndef TYPING_STATS_BUCKETS
+    #define TYPING_STATS_BUCKETS 12
+#endif
+
+// Keys held at once whose hold time can be measured
+#ifndef TYPING_STATS_MAX_HELD
+    #define TYPING_STATS_MAX_HELD 6
+#endif
+
+// Feed a key event (called from process_record_user)
+void typing_stats_record(keyrecord_t *record);
+
+// Words per minute (5 characters) over the last TYPING_STATS_RING_SIZE
+// intervals, or 0 while paused
+uint8_t typing_stats_wpm(void);
+
+// Type the WPM and both histograms as "int|hold <from ms> <count>" lines
+void typing_stats_dump(void);
@@ -3,22 +3,57 @@
 
 #include "whack_a_mole.h"
 #include "mocklogic.h"
+#include "color_math.h"
+#include "perf.h"
+#ifdef RGB_MATRIX_ENABLE
+#    include "overlay.h"
+#endif
+#include <string.h>
 
-// Game state
+// Game phases
+typedef enum {
+    GAME_IDLE,         // Not running (Kiddo layer off)
+    GAME_PLAYING,      // Moles lit, waiting for hits or timeouts
+    GAME_CELEBRATING   // Hit ripple running, moles hidden
+} game_phase_t;
+
+#define CELEBRATION_TICKS (500 / WHACK_A_MOLE_TICK_MS)
+#define RIPPLE_MAX_RADIUS 8  // Keys the ripple travels during the celebration
+
+// Difficulty levels: every WHACK_A_MOLE_HITS_PER_LEVEL hits the moles get
+// quicker and more of them show up at once (so several kids can play)
+static const struct {
+    uint16_t min_ms;  // Mole stays lit for min_ms..2*min_ms
+    uint8_t  moles;   // Simultaneous moles
+} levels[] = {
+    {1000, 1},
+    { 850, 1},
+    { 700, 2},
+    { 575, 2},
+    { 450, 3},
+    { 350, WHACK_A_MOLE_MAX_MOLES},
+};
+
+#define NUM_LEVELS (sizeof(levels) / sizeof(levels[0]))
+
+_Static_assert(WHACK_A_MOLE_HIGH_SCORES * sizeof(uint16_t) <= DATABLOCK_WHACK_A_MOLE_SIZE, "High scores exceed datablock region");
+
+#define MOLE_BITSET_SIZE ((RGB_MATRIX_LED_COUNT + 7) / 8)
+
+// Game state - only touched by key processing and whack_a_mole_tick()
 static struct {
-    uint16_t active_key;       // Currently lit key
-    uint32_t next_change_time; // When to pick next key (ms)
-    uint8_t  color_r;          // Current color RGB
-    uint8_t  color_g;
-    uint8_t  color_b;
-    bool     is_active;        // Is game running
-    uint16_t hit_key;          // Key that was just hit (for celebration effect)
-    uint8_t  hit_row;          // Row of hit key (for ripple calculation)
-    uint8_t  hit_col;          // Column of hit key (for ripple calculation)
-    uint32_t hit_start_time;   // When celebration started (ms)
-    uint32_t hit_end_time;     // When celebration effect ends (ms)
+    game_phase_t phase;
+    uint32_t     last_tick;         // Timer value of the last tick (ms)
+    uint16_t     mole_ticks[WHACK_A_MOLE_MAX_MOLES];  // Ticks until each mole moves
+    uint8_t      mole_bits[MOLE_BITSET_SIZE];         // LEDs with a mole, for O(1) hit tests
+    uint16_t     celebration_tick;  // Ticks since the hit
+    uint16_t     score;             // Hits this session
+    uint8_t      level;
 } game_state;
 
+// Render snapshot - rebuilt by the tick, read-only for the indicator code
+static whack_a_mole_frame_t frame;
+
 // Valid keys for the game (alphanumeric + symbols, no ESC, no F-keys)
 static const uint16_t valid_keys[] = {
     // Number row
@@ -51,54 +86,179 @@ static const struct {
 
 #define NUM_COLORS (sizeof(rainbow_colors) / sizeof(rainbow_colors[0]))
 
-// Select a random valid key
+// Select a random valid key (random8() steps on every call, so retries
+// within the same millisecond still try different keys)
 static uint16_t select_random_key(void) {
-    // Use timer as random seed
-    uint32_t seed = timer_read32();
-    uint8_t index = (seed * 13 + timer_read()) % NUM_VALID_KEYS;
-    return valid_keys[index];
+    return valid_keys[random8() % NUM_VALID_KEYS];
 }
 
-// Select a random color
-static void select_random_color(void) {
-    uint32_t seed = timer_read32();
-    uint8_t index = (seed * 17 + timer_read()) % NUM_COLORS;
-    game_state.color_r = rainbow_colors[index].r;
-    game_state.color_g = rainbow_colors[index].g;
-    game_state.color_b = rainbow_colors[index].b;
+// Select a random color (random8(), like the key, so moles picked in the
+// same millisecond differ)
+static RGB select_random_color(void) {
+    uint8_t index = random8() % NUM_COLORS;
+    return (RGB){rainbow_colors[index].r, rainbow_colors[index].g, rainbow_colors[index].b};
 }
 
-// Pick a new target and set timer (1-2 seconds randomly)
-static void pick_new_target(void) {
-    game_state.active_key = select_random_key();
-    select_random_color();
+// Find the LED under a keycode by searching the base layers (once per mole)
+static uint8_t find_keycode_led(uint16_t keycode) {
+    // Layer 0 (Mac) and 2 (Windows)
+    for (uint8_t layer = _MAC_BASE; layer <= _WIN_BASE; layer += _WIN_BASE - _MAC_BASE) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                PERF_COUNT(PERF_COUNT_KEYMAP_READS);
+                if (keymap_key_to_keycode(layer, (keypos_t){col, row}) == keycode) {
+                    return g_led_config.matrix_co[row][col];
+                }
+            }
+        }
+    }
+    return NO_LED;
+}
+
+static inline bool mole_at(uint8_t led) {
+    return led < RGB_MATRIX_LED_COUNT && (game_state.mole_bits[led / 8] & (1 << (led % 8)));
+}
 
-    // Random duration between 1000ms and 2000ms
-    uint32_t seed = timer_read32();
-    uint16_t duration = 1000 + ((seed * 7 + timer_read()) % 1001);
-    game_state.next_change_time = timer_read32() + duration;
+static inline void set_mole_bit(uint8_t led, bool on) {
+    if (led >= RGB_MATRIX_LED_COUNT) {
+        return;
+    }
+    if (on) {
+        game_state.mole_bits[led / 8] |= 1 << (led % 8);
+    } else {
+        game_state.mole_bits[led / 8] &= ~(1 << (led % 8));
+    }
+}
+
+// Move mole slot i to a new random key and arm its timeout
+static void pick_new_target(uint8_t i) {
+    if (i < frame.mole_count && frame.moles[i].led != NO_LED) {
+        set_mole_bit(frame.moles[i].led, false);
+    }
+
+    // Retry a few times if the key has no LED or already holds a mole
+    uint8_t led = NO_LED;
+    for (uint8_t attempt = 0; attempt < 4 && (led >= RGB_MATRIX_LED_COUNT || mole_at(led)); attempt++) {
+        led = find_keycode_led(select_random_key());
+    }
+    if (led >= RGB_MATRIX_LED_COUNT || mole_at(led)) {
+        // Nothing free this time - retry on the next tick
+        frame.moles[i].led = NO_LED;
+        game_state.mole_ticks[i] = 1;
+        return;
+    }
+
+    frame.moles[i].led = led;
+    frame.moles[i].color = select_random_color();
+    set_mole_bit(led, true);
+
+    // Random duration between min_ms and 2 * min_ms for the current level
+    uint16_t min_ms = levels[game_state.level].min_ms;
+    uint16_t duration = min_ms + (uint32_t)min_ms * random8() / 255;
+    game_state.mole_ticks[i] = duration / WHACK_A_MOLE_TICK_MS;
+}
+
+// Grow the mole count up to what the current level allows
+static void fill_moles(void) {
+    while (frame.mole_count < levels[game_state.level].moles) {
+        frame.moles[frame.mole_count].led = NO_LED;
+        pick_new_target(frame.mole_count);
+        frame.mole_count++;
+    }
+}
+
+// Publish ripple parameters for the current celebration tick
+static void update_ripple(void) {
+    uint16_t t = game_state.celebration_tick;
+    frame.ripple_radius = (t * RIPPLE_MAX_RADIUS) / CELEBRATION_TICKS;
+    frame.ripple_brightness = color_gamma8(255 - ((t * 255) / CELEBRATION_TICKS));
+
+    // Ring colors for this tick; hue cycles through the rainbow with distance,
+    // so drawing a key is a table read
+    HSV ring[WHACK_A_MOLE_RIPPLE_WIDTH];
+    for (uint8_t i = 0; i < WHACK_A_MOLE_RIPPLE_WIDTH; i++) {
+        uint8_t distance = frame.ripple_radius + i - 1;
+        ring[i] = (HSV){(distance * 32) % 255, 255, frame.ripple_brightness};
+    }
+    color_hsv_to_rgb_batch(ring, frame.ripple_colors, WHACK_A_MOLE_RIPPLE_WIDTH);
+}
+
+// Insert the session score into the persisted high-score table
+static void save_high_score(uint16_t score) {
+    uint16_t scores[WHACK_A_MOLE_HIGH_SCORES];
+    userspace_datablock_read(scores, DATABLOCK_WHACK_A_MOLE_OFFSET, sizeof(scores));
+
+    uint8_t rank = WHACK_A_MOLE_HIGH_SCORES;
+    while (rank > 0 && score > scores[rank - 1]) {
+        rank--;
+    }
+    if (rank == WHACK_A_MOLE_HIGH_SCORES) {
+        return;  // Not a high score - no EEPROM write
+    }
+
+    for (uint8_t i = WHACK_A_MOLE_HIGH_SCORES - 1; i > rank; i--) {
+        scores[i] = scores[i - 1];
+    }
+    scores[rank] = score;
+    userspace_datablock_write(scores, DATABLOCK_WHACK_A_MOLE_OFFSET, sizeof(scores));
 }
 
 void whack_a_mole_init(void) {
-    game_state.is_active = true;
-    game_state.hit_key = KC_NO;
-    game_state.hit_end_time = 0;
-    pick_new_target();
+    memset(&game_state, 0, sizeof(game_state));
+    memset(&frame, 0, sizeof(frame));
+
+    game_state.phase = GAME_PLAYING;
+    game_state.last_tick = timer_read32();
+    frame.active = true;
+    fill_moles();
 }
 
-void whack_a_mole_task(void) {
-    if (!game_state.is_active) {
+void whack_a_mole_stop(void) {
+    if (game_state.phase == GAME_IDLE) {
         return;
     }
 
-    // Check if time expired
-    if (timer_expired32(timer_read32(), game_state.next_change_time)) {
-        pick_new_target();
+    // Session over - the only time the game writes to EEPROM
+    if (game_state.score > 0) {
+        save_high_score(game_state.score);
+    }
+
+    game_state.phase = GAME_IDLE;
+    frame.active = false;
+    frame.ripple = false;
+    frame.mole_count = 0;
+}
+
+void whack_a_mole_tick(void) {
+    if (game_state.phase == GAME_IDLE) {
+        return;
+    }
+
+    // Fixed-rate ticks; catch up if housekeeping was delayed
+    while (timer_elapsed32(game_state.last_tick) >= WHACK_A_MOLE_TICK_MS) {
+        game_state.last_tick += WHACK_A_MOLE_TICK_MS;
+
+        if (game_state.phase == GAME_CELEBRATING) {
+            game_state.celebration_tick++;
+            if (game_state.celebration_tick >= CELEBRATION_TICKS) {
+                game_state.phase = GAME_PLAYING;
+                frame.ripple = false;
+            } else {
+                update_ripple();
+            }
+        }
+
+        // Mole timers keep running during the celebration, as before
+        for (uint8_t i = 0; i < frame.mole_count; i++) {
+            if (game_state.mole_ticks[i] > 0 && --game_state.mole_ticks[i] == 0) {
+                pick_new_target(i);
+            }
+        }
     }
 }
 
 bool whack_a_mole_process_key(uint16_t keycode, keyrecord_t *record) {
-    if (!game_state.is_active || !record->event.pressed) {
+    if (game_state.phase == GAME_IDLE || !record->event.pressed) {
         return false;
     }
 
@@ -115,87 +275,106 @@ bool whack_a_mole_process_key(uint16_t keycode, keyrecord_t *record) {
         return false; // Not a game key, don't consume it
     }
 
-    // Check if they hit the active mole
-    if (keycode == game_state.active_key) {
+    // Check if they hit a mole (bitset lookup, no per-mole scan)
+    uint8_t led = g_led_config.matrix_co[record->event.key.row][record->event.key.col];
+    if (mole_at(led)) {
         // Hit! Trigger celebration ripple effect (500ms)
-        game_state.hit_key = keycode;
-        game_state.hit_row = record->event.key.row;
-        game_state.hit_col = record->event.key.col;
-        game_state.hit_start_time = timer_read32();
-        game_state.hit_end_time = timer_read32() + 500;
-        pick_new_target();
+        game_state.phase = GAME_CELEBRATING;
+        game_state.celebration_tick = 0;
+        frame.ripple = true;
+        frame.ripple_row = record->event.key.row;
+        frame.ripple_col = record->event.key.col;
+        update_ripple();
+
+        if (game_state.score < UINT16_MAX) {
+            game_state.score++;
+        }
+        if (game_state.level < NUM_LEVELS - 1 && game_state.score % WHACK_A_MOLE_HITS_PER_LEVEL == 0) {
+            game_state.level++;
+        }
+
+        for (uint8_t i = 0; i < frame.mole_count; i++) {
+            if (frame.moles[i].led == led) {
+                pick_new_target(i);
+                break;
+            }
+        }
+        fill_moles();
     }
     // else: wrong key, no penalty, just ignore it
 
     return true; // Consume all game key presses to prevent typing
 }
 
-uint16_t whack_a_mole_get_active_key(void) {
-    return game_state.active_key;
-}
-
-void whack_a_mole_get_active_color(uint8_t *r, uint8_t *g, uint8_t *b) {
-    *r = game_state.color_r;
-    *g = game_state.color_g;
-    *b = game_state.color_b;
-}
-
-bool whack_a_mole_is_active(void) {
-    return game_state.is_active;
-}
+bool whack_a_mole_get_ripple_color(const whack_a_mole_frame_t *f, uint8_t row, uint8_t col, RGB *rgb) {
+    // Calculate distance from hit position (Manhattan distance)
+    int8_t row_diff = (int8_t)row - (int8_t)f->ripple_row;
+    int8_t col_diff = (int8_t)col - (int8_t)f->ripple_col;
+    uint8_t distance = (row_diff < 0 ? -row_diff : row_diff) + (col_diff < 0 ? -col_diff : col_diff);
 
-bool whack_a_mole_celebration_active(void) {
-    if (game_state.hit_key == KC_NO) {
+    // Only keys on the ring (with some thickness) are lit; inside and outside stay dark
+    if (distance > f->ripple_radius + 2 || distance + 1 < f->ripple_radius) {
         return false;
     }
-    if (timer_expired32(timer_read32(), game_state.hit_end_time)) {
-        game_state.hit_key = KC_NO;
-        return false;
-    }
-    return true;
-}
 
-uint16_t whack_a_mole_get_celebration_key(void) {
-    return game_state.hit_key;
+    // Precomputed by the tick
+    *rgb = f->ripple_colors[distance + 1 - f->ripple_radius];
+    return true;
 }
 
-void whack_a_mole_get_celebration_color(uint8_t row, uint8_t col, uint8_t *r, uint8_t *g, uint8_t *b) {
-    // Calculate elapsed time (0-500ms)
-    uint32_t elapsed = timer_read32() - game_state.hit_start_time;
-
-    // Calculate distance from hit position (Manhattan distance)
-    int8_t row_diff = (int8_t)row - (int8_t)game_state.hit_row;
-    int8_t col_diff = (int8_t)col - (int8_t)game_state.hit_col;
-    uint8_t distance = (row_diff < 0 ? -row_diff : row_diff) + (col_diff < 0 ? -col_diff : col_diff);
-
-    // Ripple expands at 8 keys per 500ms (roughly 4 keys at 250ms)
-    // Current ripple radius based on time (0-8 over 500ms)
-    uint16_t ripple_radius = (elapsed * 8) / 500;
+#ifdef RGB_MATRIX_ENABLE
+// Game logic runs in whack_a_mole_tick(); this only draws its snapshot
+void whack_a_mole_draw(void) {
+    const whack_a_mole_frame_t *f = &frame;
 
-    // Check if this key is within the current ripple (with some thickness)
-    if (distance > ripple_radius + 2) {
-        // Beyond the ripple - no color
-        *r = *g = *b = 0;
-        return;
+    // Check if celebration ripple is active
+    if (f->ripple) {
+        // Ripple effect - walk only the keys on the ring, not the whole matrix
+        int8_t reach = f->ripple_radius + 2;
+        for (int8_t dr = -reach; dr <= reach; dr++) {
+            int8_t row = f->ripple_row + dr;
+            if (row < 0 || row >= MATRIX_ROWS) {
+                continue;
+            }
+            int8_t span  = reach - (dr < 0 ? -dr : dr);
+            int8_t inner = f->ripple_radius - 1 - (dr < 0 ? -dr : dr);
+            if (inner < 0) {
+                inner = 0;
+            }
+            for (int8_t dc = -span; dc <= span; dc++) {
+                if (dc > -inner && dc < inner) {
+                    dc = inner;  // Skip the dark inside of the ring
+                }
+                int8_t col = f->ripple_col + dc;
+                if (col < 0 || col >= MATRIX_COLS) {
+                    continue;
+                }
+                RGB rgb;
+                if (whack_a_mole_get_ripple_color(f, row, col, &rgb)) {
+                    uint8_t led = g_led_config.matrix_co[row][col];
+                    if (led != NO_LED) {
+                        overlay_set(led, rgb.r, rgb.g, rgb.b, OVERLAY_OPAQUE);
+                    }
+                }
+            }
+        }
     }
-
-    if (distance < ripple_radius - 1) {
-        // Behind the ripple - faded out
-        *r = *g = *b = 0;
-        return;
+    // Show the active "mole" keys
+    else if (f->active) {
+        for (uint8_t i = 0; i < f->mole_count; i++) {
+            const whack_a_mole_mole_t *mole = &f->moles[i];
+            if (mole->led != NO_LED) {
+                overlay_set(mole->led, mole->color.r, mole->color.g, mole->color.b, OVERLAY_OPAQUE);
+            }
+        }
     }
+}
+#endif
 
-    // This key is in the ripple! Calculate rainbow color based on distance
-    // Hue cycles through rainbow based on distance (0-255)
-    uint8_t hue = (distance * 32) % 255;
-
-    // Brightness fades as ripple expands
-    uint8_t brightness = 255 - ((elapsed * 255) / 500);
-
-    // Use QMK's built-in HSV to RGB conversion
-    HSV hsv = {hue, 255, brightness};
-    RGB rgb = hsv_to_rgb(hsv);
-    *r = rgb.r;
-    *g = rgb.g;
-    *b = rgb.b;
+uint16_t whack_a_mole_get_high_score(uint8_t rank) {
+    uint16_t score = 0;
+    if (rank < WHACK_A_MOLE_HIGH_SCORES) {
+        userspace_datablock_read(&score, DATABLOCK_WHACK_A_MOLE_OFFSET + rank * sizeof(uint16_t), sizeof(score));
+    }
+    return score;
 }
@@ -5,29 +5,65 @@
 
 #include QMK_KEYBOARD_H
 
+// Game logic tick period (ms), independent of the RGB frame rate
+#ifndef WHACK_A_MOLE_TICK_MS
+    #define WHACK_A_MOLE_TICK_MS 10
+#endif
+
+// Most moles lit at once (reached at the top difficulty level)
+#ifndef WHACK_A_MOLE_MAX_MOLES
+    #define WHACK_A_MOLE_MAX_MOLES 4
+#endif
+
+// Hits needed to advance one difficulty level
+#ifndef WHACK_A_MOLE_HITS_PER_LEVEL
+    #define WHACK_A_MOLE_HITS_PER_LEVEL 10
+#endif
+
+// Session scores kept in the EEPROM high-score table
+#define WHACK_A_MOLE_HIGH_SCORES 3
+
+typedef struct {
+    uint8_t led;  // LED of the mole key
+    RGB     color;
+} whack_a_mole_mole_t;
+
+// Keys lit across the ripple ring (distances radius - 1 to radius + 2)
+#define WHACK_A_MOLE_RIPPLE_WIDTH 4
+
+// Render snapshot published by the game tick. whack_a_mole_draw() only reads
+// this, so drawing a frame never touches the timer or the game state.
+typedef struct {
+    bool    active;             // Game running
+    uint8_t mole_count;         // Entries used in moles[]
+    whack_a_mole_mole_t moles[WHACK_A_MOLE_MAX_MOLES];  // Lit keys (led NO_LED = waiting)
+    bool    ripple;             // Celebration ripple running (mole hidden)
+    uint8_t ripple_row;         // Matrix position the ripple starts from
+    uint8_t ripple_col;
+    uint8_t ripple_radius;      // Current ring radius (keys)
+    uint8_t ripple_brightness;  // Fades out as the ring grows
+    RGB     ripple_colors[WHACK_A_MOLE_RIPPLE_WIDTH];  // By distance, from ripple_radius - 1
+} whack_a_mole_frame_t;
+
 // Initialize the whack-a-mole game
 void whack_a_mole_init(void);
 
-// Update game state (called from RGB matrix effect)
-void whack_a_mole_task(void);
+// Stop the game and save the session score (called when leaving the Kiddo layer)
+void whack_a_mole_stop(void);
+
+// Advance game timers at a fixed rate (called from housekeeping)
+void whack_a_mole_tick(void);
 
 // Handle keypress events (returns true if key was consumed by game)
 bool whack_a_mole_process_key(uint16_t keycode, keyrecord_t *record);
 
-// Get current active key (for RGB display)
-uint16_t whack_a_mole_get_active_key(void);
-
-// Get current active color (for RGB display)
-void whack_a_mole_get_active_color(uint8_t *r, uint8_t *g, uint8_t *b);
-
-// Check if game is active
-bool whack_a_mole_is_active(void);
-
-// Check if celebration effect is active (correct mole was hit)
-bool whack_a_mole_celebration_active(void);
+// Ripple color for a matrix position (false if the key is outside the ring)
+bool whack_a_mole_get_ripple_color(const whack_a_mole_frame_t *frame, uint8_t row, uint8_t col, RGB *rgb);
 
-// Get key that triggered celebration
-uint16_t whack_a_mole_get_celebration_key(void);
+#ifdef RGB_MATRIX_ENABLE
+// Draw the moles, or the hit ripple, with overlay_set() (Kiddo overlay)
+void whack_a_mole_draw(void);
+#endif
 
-// Get current celebration color for a specific key position (rainbow ripple)
-void whack_a_mole_get_celebration_color(uint8_t row, uint8_t col, uint8_t *r, uint8_t *g, uint8_t *b);
+// Persisted high score by rank (0 = best)
+uint16_t whack_a_mole_get_high_score(uint8_t rank);
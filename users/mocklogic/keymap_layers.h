@@ -0,0 +1,25 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+// Generated by users/mocklogic/tools/gen_keymaps.py from users/mocklogic/keymap_src - do not edit
+
+#pragma once
+
+// Compile-time layer masks (include after enum mocklogic_layers)
+#define LAYER_MASK(layer) ((layer_state_t)1 << (layer))
+
+#define NUM_MOCKLOGIC_LAYERS 10
+
+// Default layers (OS base layers)
+#define LAYER_MASK_BASE (LAYER_MASK(_MAC_BASE) | LAYER_MASK(_WIN_BASE))
+
+// Layers left with a double-tap on LAYER_EXIT
+#define LAYER_MASK_EXIT (LAYER_MASK(_GAMING) | LAYER_MASK(_MOUSE) | LAYER_MASK(_KIDDO) | LAYER_MASK(_RGB_CFG))
+
+// Layers that disable every key they do not define
+#define LAYER_MASK_BLOCKING (LAYER_MASK(_KIDDO) | LAYER_MASK(_RGB_CFG))
+
+// Layers entered together by FN_MAC
+#define LAYER_MASK_FN_MAC (LAYER_MASK(_MAC_FN) | LAYER_MASK(_FEATURES))
+
+// Layers entered together by FN_WIN
+#define LAYER_MASK_FN_WIN (LAYER_MASK(_WIN_FN) | LAYER_MASK(_FEATURES))
@@ -5,17 +5,36 @@
 #include "features/select_word.h"
 #include "features/rgb_presets.h"
 #include "features/whack_a_mole.h"
+#include "features/autocorrect_stats.h"
+#include "features/key_usage.h"
+#include "features/typing_stats.h"
+#include "features/scheduler.h"
+#include "features/multi_tap.h"
+#include "features/host_profile.h"
+#include "features/rgb_idle.h"
+#include "features/rgb_governor.h"
+#include "features/rgb_effects.h"
+#include "features/host_leds.h"
+#include "features/overlay.h"
+#include "features/perf.h"
+#include "features/trace.h"
 #include "eeconfig.h"
 #include <string.h>
 
 // Global userspace configuration
 userspace_config_t userspace_config;
 
+// Layer state cached in layer_state_set_user() / default_layer_state_set_user(),
+// so hot paths test a bit instead of recomputing layer math per key or frame
+static layer_state_t special_layers = 0;  // layer_state & LAYER_MASK_SPECIAL
+static uint8_t       base_layer     = _WIN_BASE;
+
 // ============================================================================
 // EEPROM Configuration Management
 // ============================================================================
 
-void eeconfig_init_user_datablock(void) {
+// QMK hook: called when EEPROM is reset or found invalid
+void eeconfig_init_user(void) {
     // Initialize default values
     userspace_config.raw = 0;
     userspace_config.autocorrect_enabled = true;   // Autocorrect ON by default
@@ -23,16 +42,23 @@ void eeconfig_init_user_datablock(void) {
     userspace_config.active_rgb_preset = 1;        // Preset 2 (dim white) by default
 
     // Initialize RGB preset 4 (F8) defaults
-    userspace_config.rgb_preset_mode = RGB_MATRIX_TYPING_HEATMAP;
+    userspace_config.rgb_preset_mode = RGB_MATRIX_CUSTOM_sparse_heatmap;
+    userspace_config.rgb_preset_mode_v2 = true;
     userspace_config.rgb_preset_hue = 0;
     userspace_config.rgb_preset_sat = 255;
     userspace_config.rgb_preset_val = 255;
     userspace_config.rgb_preset_speed = RGB_MATRIX_SPD_STEP * 2;
 
     userspace_config_save();
+
+#ifdef OS_DETECTION_ENABLE
+    // No OS switch: start in Windows mode until the first detection
+    eeconfig_update_default_layer(LAYER_MASK(_WIN_BASE));
+#endif
 }
 
 void userspace_config_save(void) {
+    PERF_COUNT(PERF_COUNT_EEPROM_WRITES);
     eeconfig_update_user(userspace_config.raw);
 }
 
@@ -44,13 +70,53 @@ void userspace_config_load(void) {
         userspace_config.active_rgb_preset = 1;
         userspace_config_save();
     }
+    if (userspace_config.host_override > HOST_OVERRIDE_WIN) {
+        userspace_config.host_override = HOST_OVERRIDE_AUTO;
+        userspace_config_save();
+    }
+
+    // Feature data lives in the user datablock; zero it if the layout changed
+    if (!eeconfig_is_user_datablock_valid()) {
+        eeconfig_init_user_datablock();
+    }
+}
+
+_Static_assert(DATABLOCK_END <= EECONFIG_USER_DATA_SIZE, "Datablock layout exceeds EECONFIG_USER_DATA_SIZE");
+
+void userspace_datablock_read(void *data, uint16_t offset, uint16_t size) {
+    eeconfig_read_user_datablock(data, offset, size);
+}
+
+void userspace_datablock_write(const void *data, uint16_t offset, uint16_t size) {
+    PERF_COUNT(PERF_COUNT_EEPROM_WRITES);
+    eeconfig_update_user_datablock(data, offset, size);
+}
+
+// Host profile changed: resolve OS-specific tables once, not per keypress
+static void host_profile_changed(host_profile_t profile) {
+    select_word_set_mac_mode(profile == HOST_PROFILE_MAC);
 }
 
 // QMK hook: called after keyboard init
 void keyboard_post_init_user(void) {
     userspace_config_load();
+#ifdef MOCKLOGIC_PERF_ENABLE
+    perf_init();
+#endif
+    autocorrect_stats_init();
+    key_usage_init();
+    base_layer = get_highest_layer(default_layer_state);
+    host_profile_set_base_layer_mac(base_layer == _MAC_BASE);
+    host_profile_init(userspace_config.host_override, host_profile_changed);
+    host_leds_set_layer(base_layer);
     rgb_preset_init();
     rgb_preset_apply(userspace_config.active_rgb_preset);
+#ifdef RGB_MATRIX_ENABLE
+    rgb_idle_init();
+    rgb_indicators_init();
+#endif
+
+    mouse_jiggler_init();
 }
 
 // Optional helper (declared in mocklogic.h) if you want a separate hook
@@ -63,13 +129,36 @@ void keyboard_post_init_user_rgb(void) {
 // Mouse Jiggler Implementation (custom pointing device driver stubs)
 // -----------------------------------------------------------------------------
 
+// Pending nudge steps: 2 = move right, 1 = move back, 0 = idle
+static uint8_t jiggle_steps = 0;
+
+// Scheduler: time for the next nudge
+static uint32_t mouse_jiggler_nudge(void) {
+    jiggle_steps = 2;
+    return MOUSE_JIGGLER_INTERVAL;
+}
+
+void mouse_jiggler_init(void) {
+    scheduler_register(SCHED_JIGGLER, mouse_jiggler_nudge);
+    if (userspace_config.mouse_jiggler_enabled) {
+        scheduler_wake_in(SCHED_JIGGLER, MOUSE_JIGGLER_INTERVAL);
+    }
+}
+
 // Driver init must return bool (true = initialized)
 bool pointing_device_driver_init(void) {
     return true;
 }
 
 report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
-    // Pass-through (you could inject movement here when jiggler is enabled)
+    // Inject a 1px out-and-back nudge so the host sees motion and doesn't go idle
+    if (jiggle_steps == 2) {
+        mouse_report.x = 1;
+        jiggle_steps = 1;
+    } else if (jiggle_steps == 1) {
+        mouse_report.x = -1;
+        jiggle_steps = 0;
+    }
     return mouse_report;
 }
 
@@ -81,21 +170,18 @@ void pointing_device_driver_set_cpi(uint16_t cpi) {
     (void)cpi;
 }
 
-// Override to force mouse reports when jiggler is active
-bool has_mouse_report_changed(report_mouse_t *new_report, report_mouse_t *old_report) {
-    if (userspace_config.mouse_jiggler_enabled) {
-        // Force a report so the host sees motion and doesn't go idle
-        return true;
-    }
-    return memcmp(new_report, old_report, sizeof(report_mouse_t)) != 0;
-}
-
 bool get_mouse_jiggler_enabled(void) {
     return userspace_config.mouse_jiggler_enabled;
 }
 
 void set_mouse_jiggler_enabled(bool enabled) {
     userspace_config.mouse_jiggler_enabled = enabled;
+    if (enabled) {
+        scheduler_wake_in(SCHED_JIGGLER, MOUSE_JIGGLER_INTERVAL);
+    } else {
+        scheduler_cancel(SCHED_JIGGLER);
+        jiggle_steps = 0;
+    }
     userspace_config_save();
 }
 
@@ -129,16 +215,48 @@ bool process_autocorrect_user(uint16_t *keycode, keyrecord_t *record,
     (void)mods;
 
     // Skip autocorrect if disabled or in Gaming layer
-    if (!userspace_config.autocorrect_enabled || layer_state_is(_GAMING)) {
+    if (!userspace_config.autocorrect_enabled || (special_layers & LAYER_MASK(_GAMING))) {
         return false;
     }
     return true;
 }
 
+// QMK hook: called when a typo is about to be corrected
+bool apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct) {
+    (void)backspaces;
+    (void)str;
+    (void)correct;
+    PERF_SCOPE(PERF_AUTOCORRECT);
+
+    autocorrect_stats_record(typo);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Housekeeping and Suspend
+// -----------------------------------------------------------------------------
+
+void housekeeping_task_user(void) {
+    // Game logic ticks here so it keeps running when RGB is off or suspended
+    whack_a_mole_tick();
+}
+
+void suspend_power_down_user(void) {
+    // Host went to sleep - persist anything still pending
+    autocorrect_stats_flush();
+    key_usage_flush();
+}
+
 // -----------------------------------------------------------------------------
 // Leader Key Sequences
 // -----------------------------------------------------------------------------
 
+static void set_host_override(host_override_t override) {
+    userspace_config.host_override = override;
+    userspace_config_save();
+    host_profile_set_override(override);
+}
+
 void leader_start_user(void) {
     // Turn on leader layer for visual feedback
     layer_on(_LEADER);
@@ -183,6 +301,134 @@ void leader_end_user(void) {
     else if (leader_sequence_five_keys(KC_P, KC_R, KC_I, KC_N, KC_T)) {
         tap_code(KC_PSCR);
     }
+    // TYPO  — Type autocorrect hit counts (for pruning the dictionary)
+    else if (leader_sequence_four_keys(KC_T, KC_Y, KC_P, KC_O)) {
+        autocorrect_stats_dump();
+    }
+    // WPM   — Type typing speed and interval / hold time histograms
+    else if (leader_sequence_three_keys(KC_W, KC_P, KC_M)) {
+        typing_stats_dump();
+    }
+    // KEYS  — Type lifetime press counts per matrix position
+    else if (leader_sequence_four_keys(KC_K, KC_E, KC_Y, KC_S)) {
+        key_usage_dump();
+    }
+#ifdef MOCKLOGIC_PERF_ENABLE
+    // PERF  — Type the timing probe report and start a new window
+    else if (leader_sequence_four_keys(KC_P, KC_E, KC_R, KC_F)) {
+        perf_report();
+    }
+#endif
+#ifdef MOCKLOGIC_TRACE_ENABLE
+    // TRACE — Type the key event trace (decode with tools/trace_decode.py)
+    else if (leader_sequence_five_keys(KC_T, KC_R, KC_A, KC_C, KC_E)) {
+        trace_dump();
+    }
+#endif
+    // MOLE  — Type the whack-a-mole high scores
+    else if (leader_sequence_four_keys(KC_M, KC_O, KC_L, KC_E)) {
+        for (uint8_t rank = 0; rank < WHACK_A_MOLE_HIGH_SCORES; rank++) {
+            send_string(get_u16_str(whack_a_mole_get_high_score(rank), ' '));
+            send_char('\n');
+        }
+    }
+    // MAC / WIN / AUTO — Force the host profile, or follow switch/detection again
+    else if (leader_sequence_three_keys(KC_M, KC_A, KC_C)) {
+        set_host_override(HOST_OVERRIDE_MAC);
+    }
+    else if (leader_sequence_three_keys(KC_W, KC_I, KC_N)) {
+        set_host_override(HOST_OVERRIDE_WIN);
+    }
+    else if (leader_sequence_four_keys(KC_A, KC_U, KC_T, KC_O)) {
+        set_host_override(HOST_OVERRIDE_AUTO);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Layer Exit (double-tap ESC, replaces the old per-layer tap dances)
+// -----------------------------------------------------------------------------
+
+typedef void (*layer_exit_callback_t)(void);
+
+static void layer_exit_kiddo(void) {
+    // Reset RGB to active preset
+    rgb_preset_apply(userspace_config.active_rgb_preset);
+}
+
+static void layer_exit_rgb_cfg(void) {
+#ifdef RGB_MATRIX_ENABLE
+    key_usage_view_close();
+#endif
+    rgb_config_layer_exit();
+    // Preset 4 (F8) remains active with saved settings
+    userspace_config.active_rgb_preset = 3;
+    userspace_config_save();
+}
+
+// Extra work after leaving a layer (layers in LAYER_MASK_EXIT without an entry just turn off)
+static const layer_exit_callback_t layer_exit_callbacks[NUM_MOCKLOGIC_LAYERS] = {
+    [_KIDDO]   = layer_exit_kiddo,
+    [_RGB_CFG] = layer_exit_rgb_cfg,
+};
+
+static multi_tap_t exit_taps;
+static bool        exit_esc_held = false;
+
+static bool process_layer_exit(keyrecord_t *record) {
+    if (!record->event.pressed) {
+        if (exit_esc_held) {
+            unregister_code(KC_ESC);
+            exit_esc_held = false;
+        }
+        return false;
+    }
+
+    uint8_t layer = get_highest_layer(layer_state & LAYER_MASK_EXIT);
+
+    // Second tap: leave the highest special layer
+    if (multi_tap_press(&exit_taps, record->event.time, LAYER_EXIT_TAP_TERM) >= 2) {
+        multi_tap_reset(&exit_taps);
+        if (layer_state & LAYER_MASK_EXIT) {
+            layer_off(layer);
+            if (layer_exit_callbacks[layer]) {
+                layer_exit_callbacks[layer]();
+            }
+        }
+        return false;
+    }
+
+    // First tap: ESC goes out right away, except on layers that block all keys
+    if (!(LAYER_MASK(layer) & LAYER_MASK_BLOCKING)) {
+        register_code(KC_ESC);
+        exit_esc_held = true;
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+// Host-Aware Keys
+// -----------------------------------------------------------------------------
+
+enum host_chord_slot {
+    HOST_CHORD_TASK_VIEW,
+    HOST_CHORD_FILE_EXPLORER,
+    HOST_CHORD_TASK_MGR,
+    HOST_CHORD_ZOOM_IN,
+    HOST_CHORD_ZOOM_OUT,
+    HOST_CHORD_COUNT
+};
+
+// Chord sent on press, so the release matches even if the profile changed in between
+static uint16_t held_host_chords[HOST_CHORD_COUNT];
+
+static void process_host_chord(uint8_t slot, keyrecord_t *record, uint16_t win_chord, uint16_t mac_chord) {
+    if (record->event.pressed) {
+        held_host_chords[slot] = host_profile_is_mac() ? mac_chord : win_chord;
+        register_code16(held_host_chords[slot]);
+    } else if (held_host_chords[slot]) {
+        unregister_code16(held_host_chords[slot]);
+        held_host_chords[slot] = KC_NO;
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -190,14 +436,40 @@ void leader_end_user(void) {
 // -----------------------------------------------------------------------------
 
 bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    PERF_SCOPE(PERF_PROCESS_RECORD);
+#ifdef MOCKLOGIC_TRACE_ENABLE
+    trace_record(record);
+#endif
+
+#ifdef RGB_MATRIX_ENABLE
+    // Wake the LEDs before anything below changes RGB settings
+    rgb_idle_activity();
+#endif
+    typing_stats_record(record);
+    if (record->event.pressed) {
+        key_usage_record(record);
+#ifdef RGB_MATRIX_ENABLE
+        rgb_speed_link_activity();
+#endif
+#ifdef RGB_MATRIX_CUSTOM_USER
+        rgb_effects_key_pressed(record);
+#endif
+    }
+
+    // Any key but LAYER_EXIT breaks an ESC double-tap. Reset before the Kiddo
+    // and RGB Config handlers below, which consume their keys.
+    if (keycode != LAYER_EXIT && record->event.pressed) {
+        multi_tap_reset(&exit_taps);
+    }
+
     // Whack-a-mole game (only active on Kiddo layer)
-    if (layer_state_is(_KIDDO)) {
+    if (special_layers & LAYER_MASK(_KIDDO)) {
         // On Kiddo layer, all keys are KC_NO, so we need to look up the actual keycode
         // from the base layer to know what key was physically pressed
         uint16_t base_keycode = keycode;
         if (keycode == KC_NO) {
             // Look up the keycode from Mac or Windows base layer
-            uint8_t base_layer = get_highest_layer(default_layer_state); // 0 for Mac, 2 for Windows
+            PERF_COUNT(PERF_COUNT_KEYMAP_READS);
             base_keycode = keymap_key_to_keycode(base_layer, record->event.key);
         }
 
@@ -207,7 +479,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     }
 
     // RGB config layer - handle encoder hue controls
-    if (layer_state_is(_RGB_CFG) && record->event.pressed) {
+    if ((special_layers & LAYER_MASK(_RGB_CFG)) && record->event.pressed) {
         switch (keycode) {
             case RM_HUEU:
                 rgb_config_adjust_hue(RGB_MATRIX_HUE_STEP);
@@ -220,6 +492,11 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
         }
     }
 
+    // Double-tap ESC to leave a special layer
+    if (keycode == LAYER_EXIT) {
+        return process_layer_exit(record);
+    }
+
     // Select-word feature (returns false when it consumes the event)
     if (!process_select_word(keycode, record, SELWORD)) {
         return false;
@@ -228,44 +505,38 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     switch (keycode) {
         // Dual-layer function keys
         case FN_MAC:
+            // Both layers in one layer_state_set, so only one layer update runs
             if (record->event.pressed) {
-                layer_on(_MAC_FN);
-                layer_on(_FEATURES);
+                layer_or(LAYER_MASK_FN_MAC);
             } else {
-                layer_off(_MAC_FN);
-                layer_off(_FEATURES);
+                layer_and(~LAYER_MASK_FN_MAC);
             }
             return false;
 
         case FN_WIN:
             if (record->event.pressed) {
-                layer_on(_WIN_FN);
-                layer_on(_FEATURES);
+                layer_or(LAYER_MASK_FN_WIN);
             } else {
-                layer_off(_WIN_FN);
-                layer_off(_FEATURES);
+                layer_and(~LAYER_MASK_FN_WIN);
             }
             return false;
 
         // Windows-specific shortcuts
         case KC_TASK_VIEW:
-            if (record->event.pressed) {
-                register_code(KC_LWIN);
-                register_code(KC_TAB);
-            } else {
-                unregister_code(KC_TAB);
-                unregister_code(KC_LWIN);
-            }
+            process_host_chord(HOST_CHORD_TASK_VIEW, record, G(KC_TAB), C(KC_UP));
             return false;
 
         case KC_FILE_EXPLORER:
-            if (record->event.pressed) {
-                register_code(KC_LWIN);
-                register_code(KC_E);
-            } else {
-                unregister_code(KC_E);
-                unregister_code(KC_LWIN);
-            }
+            process_host_chord(HOST_CHORD_FILE_EXPLORER, record, G(KC_E), G(A(KC_SPC)));
+            return false;
+
+        // Zoom (encoder on the FN layers)
+        case ZOOM_IN:
+            process_host_chord(HOST_CHORD_ZOOM_IN, record, C(KC_PPLS), G(KC_PPLS));
+            return false;
+
+        case ZOOM_OUT:
+            process_host_chord(HOST_CHORD_ZOOM_OUT, record, C(KC_PMNS), G(KC_PMNS));
             return false;
 
         // Toggle autocorrect
@@ -336,7 +607,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
 
         case RGB_EFF_DIGRAIN:
             if (record->event.pressed) {
-                rgb_config_set_effect(RGB_MATRIX_DIGITAL_RAIN);
+                rgb_config_set_effect(RGB_MATRIX_CUSTOM_column_rain);
             }
             return false;
 
@@ -360,7 +631,7 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
 
         case RGB_EFF_HEATMAP:
             if (record->event.pressed) {
-                rgb_config_set_effect(RGB_MATRIX_TYPING_HEATMAP);
+                rgb_config_set_effect(RGB_MATRIX_CUSTOM_sparse_heatmap);
             }
             return false;
 
@@ -370,6 +641,20 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             }
             return false;
 
+        case RGB_SPEED_WPM:
+            if (record->event.pressed) {
+                rgb_config_toggle_speed_wpm();
+            }
+            return false;
+
+        case RGB_USAGE_VIEW:
+#ifdef RGB_MATRIX_ENABLE
+            if (record->event.pressed) {
+                key_usage_view_toggle();
+            }
+#endif
+            return false;
+
         // RGB Config Layer - Adjustments
         case RGB_BRIGHT_UP:
             if (record->event.pressed) {
@@ -415,17 +700,9 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
             }
             return false;
 
-        // Task Manager (Ctrl+Shift+Esc)
+        // Task Manager (Ctrl+Shift+Esc), Force Quit (Cmd+Opt+Esc) on Mac
         case TASK_MGR:
-            if (record->event.pressed) {
-                register_code(KC_LCTL);
-                register_code(KC_LSFT);
-                register_code(KC_ESC);
-            } else {
-                unregister_code(KC_ESC);
-                unregister_code(KC_LSFT);
-                unregister_code(KC_LCTL);
-            }
+            process_host_chord(HOST_CHORD_TASK_MGR, record, C(S(KC_ESC)), G(A(KC_ESC)));
             return false;
     }
 
@@ -437,39 +714,114 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
 // -----------------------------------------------------------------------------
 
 layer_state_t layer_state_set_user(layer_state_t state) {
+    layer_state_t changed = (state ^ layer_state) & LAYER_MASK(_KIDDO);
+
     // Initialize whack-a-mole game when entering Kiddo layer
-    if (layer_state_cmp(state, _KIDDO) && !layer_state_cmp(layer_state, _KIDDO)) {
+    if (changed && (state & LAYER_MASK(_KIDDO))) {
         whack_a_mole_init();
+    } else if (changed) {
+        whack_a_mole_stop();
     }
+
+    // Cache what the per-key and per-frame code asks about
+    special_layers = state & LAYER_MASK_SPECIAL;
+
+#ifdef RGB_MATRIX_ENABLE
+    // The game animates through the indicators, even over a solid background
+    rgb_governor_set_fast(special_layers & LAYER_MASK(_KIDDO));
+    // Indicator overlays follow the layers, not the frame loop
+    rgb_indicators_set_layers(state);
+#endif
+    return state;
+}
+
+// Default layer follows the OS (Keychron switch or GMMK OS detection)
+layer_state_t default_layer_state_set_user(layer_state_t state) {
+    base_layer = get_highest_layer(state);
+    host_profile_set_base_layer_mac(base_layer == _MAC_BASE);
+    host_leds_set_layer(base_layer);
     return state;
 }
 
+// Host lock LEDs changed (Caps Lock etc.)
+bool led_update_user(led_t led_state) {
+    host_leds_update(led_state);
+    return true;
+}
+
+#ifdef OS_DETECTION_ENABLE
+// Boards without an OS switch follow the detected host. The persisted default
+// layer doubles as the cache of the last detected host: QMK restores it at boot,
+// so the right layout is active before detection finishes, and detection only
+// confirms it. EEPROM is written only when the host actually changed.
+bool process_detected_host_os_user(os_variant_t detected_os) {
+    uint8_t layer;
+    switch (detected_os) {
+        case OS_MACOS:
+        case OS_IOS:
+            layer = _MAC_BASE;
+            break;
+        case OS_WINDOWS:
+        case OS_LINUX:
+            layer = _WIN_BASE;
+            break;
+        case OS_UNSURE:
+        default:
+            return true;  // Keep the cached layout
+    }
+
+    host_profile_set_detected(detected_os);
+    if (layer != base_layer) {
+        set_single_persistent_default_layer(layer);
+    }
+    return true;
+}
+#endif
+
 // -----------------------------------------------------------------------------
 // RGB Matrix Indicators (portable, keycode-based)
 // -----------------------------------------------------------------------------
 #ifdef RGB_MATRIX_ENABLE
 
+// Build-time LED map from tools/gen_led_map.py (generated by rules.mk). Without
+// it the indicators fall back to searching the keymap at runtime.
+#if defined(__has_include)
+#    if __has_include("mocklogic_led_map.h")
+#        include "mocklogic_led_map.h"
+#    endif
+#endif
+
 // Helper: Set LED color for a specific keycode on a given layer
-static void set_led_color_for_keycode(uint8_t layer, uint16_t keycode,
-                                      uint8_t r, uint8_t g, uint8_t b) {
+static inline __attribute__((always_inline)) void set_led_color_for_keycode(uint8_t layer, uint16_t keycode,
+                                                                             uint8_t r, uint8_t g, uint8_t b) {
+#ifdef MOCKLOGIC_LED_MAP
+    // Constant layer and keycode: this folds to direct writes to known LEDs
+    const uint8_t *leds;
+    uint8_t        count = led_map_lookup(layer, keycode, &leds);
+    for (uint8_t i = 0; i < count; i++) {
+        overlay_set(leds[i], r, g, b, OVERLAY_OPAQUE);
+    }
+#else
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            PERF_COUNT(PERF_COUNT_KEYMAP_READS);
             uint16_t key = keymap_key_to_keycode(layer, (keypos_t){col, row});
             if (key == keycode) {
                 uint8_t led_index = g_led_config.matrix_co[row][col];
                 if (led_index != NO_LED) {
-                    rgb_matrix_set_color(led_index, r, g, b);
+                    overlay_set(led_index, r, g, b, OVERLAY_OPAQUE);
                 }
             }
         }
     }
+#endif
 }
 
 // Features Layer indicators
 void rgb_matrix_indicators_features_layer(void) {
 
     // Only show these when the Win Fn layer is active
-    if (layer_state_is(_WIN_FN)) {
+    if (special_layers & LAYER_MASK(_WIN_FN)) {
         // F4 — Task Manager (green)
         set_led_color_for_keycode(_WIN_FN, TASK_MGR, RGB_GREEN);
         // Show Desktop (green)
@@ -479,7 +831,7 @@ void rgb_matrix_indicators_features_layer(void) {
     }
 
     // Only show these when the Mac Fn layer is active
-    if (layer_state_is(_MAC_FN)) {
+    if (special_layers & LAYER_MASK(_MAC_FN)) {
         // Paste (green)
         set_led_color_for_keycode(_MAC_FN, C(KC_V), RGB_GREEN);
     }
@@ -528,7 +880,7 @@ void rgb_matrix_indicators_features_layer(void) {
 // Gaming Layer indicators
 void rgb_matrix_indicators_gaming_layer(void) {
     // ESC to exit (purple)
-    set_led_color_for_keycode(_GAMING, TD(TD_ESC_GAMING), RGB_PURPLE);
+    set_led_color_for_keycode(_GAMING, LAYER_EXIT, RGB_PURPLE);
 
     // Highlight WASD
     set_led_color_for_keycode(_GAMING, KC_W, RGB_GREEN);
@@ -556,82 +908,34 @@ void rgb_matrix_indicators_mouse_layer(void) {
     set_led_color_for_keycode(_MOUSE, MS_BTN1, RGB_SPRINGGREEN);
     set_led_color_for_keycode(_MOUSE, MS_BTN2, RGB_SPRINGGREEN);
 
-    // Tap-dance ESC to exit (purple)
-    set_led_color_for_keycode(_MOUSE, TD(TD_ESC_MOUSE), RGB_PURPLE);
+    // Double-tap ESC to exit (purple)
+    set_led_color_for_keycode(_MOUSE, LAYER_EXIT, RGB_PURPLE);
 
     // Disabled keys
     set_led_color_for_keycode(_MOUSE, KC_NO, 0x28, 0x00, 0x00);
 }
 
-// Helper: Find matrix position for a keycode by searching base layers
-static bool find_keycode_position(uint16_t keycode, uint8_t *out_row, uint8_t *out_col) {
-    // Search Mac base layer first, then Windows base layer
-    for (uint8_t layer = 0; layer <= 2; layer += 2) {  // Layer 0 (Mac) and 2 (Windows)
-        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-                if (keymap_key_to_keycode(layer, (keypos_t){col, row}) == keycode) {
-                    *out_row = row;
-                    *out_col = col;
-                    return true;
-                }
-            }
-        }
-    }
-    return false;
-}
-
 // Kiddo Layer indicators
 void rgb_matrix_indicators_kiddo_layer(void) {
-    // Update whack-a-mole game state
-    whack_a_mole_task();
-
-    // Check if celebration ripple is active
-    if (whack_a_mole_celebration_active()) {
-        // Ripple effect - check all keys for ripple coloring
-        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-                uint8_t r, g, b;
-                whack_a_mole_get_celebration_color(row, col, &r, &g, &b);
-                // Only set color if it's non-black (within ripple)
-                if (r != 0 || g != 0 || b != 0) {
-                    uint8_t led = g_led_config.matrix_co[row][col];
-                    if (led != NO_LED) {
-                        rgb_matrix_set_color(led, r, g, b);
-                    }
-                }
-            }
-        }
-    }
-    // Show the active "mole" key
-    else if (whack_a_mole_is_active()) {
-        uint16_t active_key = whack_a_mole_get_active_key();
-        uint8_t r, g, b;
-        whack_a_mole_get_active_color(&r, &g, &b);
-
-        // Find the matrix position for this keycode by searching base layers
-        uint8_t row, col;
-        if (find_keycode_position(active_key, &row, &col)) {
-            uint8_t led = g_led_config.matrix_co[row][col];
-            if (led != NO_LED) {
-                rgb_matrix_set_color(led, r, g, b);
-            }
-        }
-    }
+    // Moles or the hit ripple
+    whack_a_mole_draw();
 
-    // ESC to exit (purple) - find ESC key position in base layer
-    uint8_t esc_row, esc_col;
-    if (find_keycode_position(KC_ESC, &esc_row, &esc_col)) {
-        uint8_t led = g_led_config.matrix_co[esc_row][esc_col];
-        if (led != NO_LED) {
-            rgb_matrix_set_color(led, RGB_PURPLE);
-        }
-    }
+    // Double-tap ESC to exit (purple)
+    set_led_color_for_keycode(_KIDDO, LAYER_EXIT, RGB_PURPLE);
 }
 
 // RGB Config Layer indicators
 void rgb_matrix_indicators_rgb_layer(void) {
+    // Key usage heatmap replaces the layer's key colors while it is open
+    if (key_usage_view_is_open()) {
+        key_usage_view_render();
+        set_led_color_for_keycode(_RGB_CFG, LAYER_EXIT, RGB_PURPLE);
+        set_led_color_for_keycode(_RGB_CFG, RGB_USAGE_VIEW, RGB_WHITE);
+        return;
+    }
+
     // ESC to exit (purple)
-    set_led_color_for_keycode(_RGB_CFG, TD(TD_ESC_RGB), RGB_PURPLE);
+    set_led_color_for_keycode(_RGB_CFG, LAYER_EXIT, RGB_PURPLE);
 
     // Effect selection keys (black/off to highlight against active effect)
     // Subtle effects
@@ -640,8 +944,9 @@ void rgb_matrix_indicators_rgb_layer(void) {
     set_led_color_for_keycode(_RGB_CFG, RGB_EFF_RAINDROPS, RGB_BLACK);
     set_led_color_for_keycode(_RGB_CFG, RGB_EFF_DIGRAIN,   RGB_BLACK);
 
-    // Reset to saved preset
+    // Reset to saved preset, key usage view
     set_led_color_for_keycode(_RGB_CFG, RGB_CFG_RESET, RGB_BLACK);
+    set_led_color_for_keycode(_RGB_CFG, RGB_USAGE_VIEW, RGB_BLACK);
 
     // Crazy effects
     set_led_color_for_keycode(_RGB_CFG, RGB_EFF_SPIRAL,  RGB_BLACK);
@@ -654,6 +959,11 @@ void rgb_matrix_indicators_rgb_layer(void) {
     set_led_color_for_keycode(_RGB_CFG, RGB_BRIGHT_DOWN, RGB_BLACK);
     set_led_color_for_keycode(_RGB_CFG, RGB_SPEED_UP,    RGB_BLACK);
     set_led_color_for_keycode(_RGB_CFG, RGB_SPEED_DOWN,  RGB_BLACK);
+    if (rgb_config_speed_wpm_enabled()) {
+        set_led_color_for_keycode(_RGB_CFG, RGB_SPEED_WPM, RGB_WHITE);  // Linked
+    } else {
+        set_led_color_for_keycode(_RGB_CFG, RGB_SPEED_WPM, RGB_BLACK);
+    }
     set_led_color_for_keycode(_RGB_CFG, RGB_SAT_UP,      RGB_BLACK);
     set_led_color_for_keycode(_RGB_CFG, RGB_SAT_DOWN,    RGB_BLACK);
 }
@@ -666,48 +976,46 @@ void rgb_matrix_indicators_leader_layer(void) {
     set_led_color_for_keycode(_LEADER, KC_NO, 0x28, 0x00, 0x00);
 }
 
-// Main RGB indicator hook
-bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
-    (void)led_min;
-    (void)led_max;
-
-    // CapsLock indicator: light the Caps key blue when active
-    if (host_keyboard_led_state().caps_lock) {
-        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
-            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-                uint16_t key = keymap_key_to_keycode(0, (keypos_t){col, row});
-                if (key == KC_CAPS) {
-                    uint8_t led_index = g_led_config.matrix_co[row][col];
-                    if (led_index != NO_LED) {
-                        rgb_matrix_set_color(led_index, RGB_BLUE);
-                    }
-                }
-            }
-        }
+// Overlays in draw order: each layer's indicators show while the layer is on,
+// higher layers on top. Lock keys stay visible over everything.
+static const struct {
+    overlay_id_t   id;
+    uint8_t        layer;
+    overlay_draw_t draw;
+} layer_overlays[] = {
+    {OVERLAY_FEATURES, _FEATURES, rgb_matrix_indicators_features_layer},
+    {OVERLAY_GAMING,   _GAMING,   rgb_matrix_indicators_gaming_layer},
+    {OVERLAY_MOUSE,    _MOUSE,    rgb_matrix_indicators_mouse_layer},
+    {OVERLAY_KIDDO,    _KIDDO,    rgb_matrix_indicators_kiddo_layer},
+    {OVERLAY_RGB_CFG,  _RGB_CFG,  rgb_matrix_indicators_rgb_layer},
+    {OVERLAY_LEADER,   _LEADER,   rgb_matrix_indicators_leader_layer},
+};
+
+// Called from layer_state_set_user()
+void rgb_indicators_set_layers(layer_state_t state) {
+    // A layer that blocks all other keys hides the indicators of the layers below it
+    layer_state_t blocking = state & LAYER_MASK_BLOCKING;
+    if (blocking) {
+        state &= ~(LAYER_MASK(get_highest_layer(blocking)) - 1);
     }
+    for (uint8_t i = 0; i < ARRAY_SIZE(layer_overlays); i++) {
+        overlay_set_active(layer_overlays[i].id, state & LAYER_MASK(layer_overlays[i].layer));
+    }
+}
 
-    // Layer-specific indicators
-    switch (get_highest_layer(layer_state)) {
-        case _FEATURES:
-            rgb_matrix_indicators_features_layer();
-            break;
-        case _GAMING:
-            rgb_matrix_indicators_gaming_layer();
-            break;
-        case _MOUSE:
-            rgb_matrix_indicators_mouse_layer();
-            break;
-        case _KIDDO:
-            rgb_matrix_indicators_kiddo_layer();
-            break;
-        case _RGB_CFG:
-            rgb_matrix_indicators_rgb_layer();
-            break;
-        case _LEADER:
-            rgb_matrix_indicators_leader_layer();
-            break;
+void rgb_indicators_init(void) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(layer_overlays); i++) {
+        overlay_register(layer_overlays[i].id, layer_overlays[i].layer, layer_overlays[i].draw);
     }
+    overlay_register(OVERLAY_LOCKS, UINT8_MAX, host_leds_render);
+    overlay_set_active(OVERLAY_LOCKS, true);
+    rgb_indicators_set_layers(layer_state);
+}
 
+// Main RGB indicator hook
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    PERF_SCOPE(PERF_INDICATORS);
+    overlay_render(led_min, led_max);
     return false;
 }
 #endif  // RGB_MATRIX_ENABLE
@@ -19,11 +19,17 @@ enum mocklogic_layers {
     _LEADER         // Leader key active layer
 };
 
+// Layer masks generated from keymap_src/layers.json
+#include "keymap_layers.h"
+
+// Layers that hot paths (key processing, autocorrect, indicators) test for
+#define LAYER_MASK_SPECIAL (LAYER_MASK(_MAC_FN) | LAYER_MASK(_WIN_FN) | LAYER_MASK(_GAMING) | LAYER_MASK(_KIDDO) | LAYER_MASK(_RGB_CFG))
+
 // Custom keycodes
 enum mocklogic_keycodes {
-    // Windows/Mac-specific keys (note: KC_MISSION_CONTROL and KC_LAUNCHPAD are now built-in)
-    KC_TASK_VIEW = SAFE_RANGE,
-    KC_FILE_EXPLORER,
+    // Host-aware keys, resolved by features/host_profile.h (note: KC_MISSION_CONTROL and KC_LAUNCHPAD are now built-in)
+    KC_TASK_VIEW = SAFE_RANGE,  // Win+Tab, Mission Control (Ctrl+Up) on Mac
+    KC_FILE_EXPLORER,           // Win+E, Finder search (Cmd+Opt+Space) on Mac
 
     // Feature toggles
     TOGGLE_AUTOCORRECT,  // Toggle autocorrect on/off
@@ -39,12 +45,14 @@ enum mocklogic_keycodes {
     RGB_EFF_SOLID,      // Solid color
     RGB_EFF_STARLIGHT,  // Starlight dual
     RGB_EFF_RAINDROPS,  // Raindrops
-    RGB_EFF_DIGRAIN,    // Digital rain
+    RGB_EFF_DIGRAIN,    // Column rain (userspace effect)
     RGB_EFF_SPIRAL,     // Rainbow pinwheel
     RGB_EFF_SPLASH,     // Rainbow splash ripples
     RGB_EFF_RIVER,      // Riverflow
-    RGB_EFF_HEATMAP,    // Typing heatmap
+    RGB_EFF_HEATMAP,    // Sparse typing heatmap (userspace effect)
     RGB_CFG_RESET,      // Reset to saved RGB config
+    RGB_USAGE_VIEW,     // Toggle the key usage heatmap view
+    RGB_SPEED_WPM,      // Link effect speed to typing speed (toggle)
 
     // RGB config layer - adjustments
     RGB_BRIGHT_UP,      // Increase brightness
@@ -56,25 +64,24 @@ enum mocklogic_keycodes {
 
     // Utility keys
     SELWORD,       // Select word/line
-    TASK_MGR,      // Windows Task Manager (Ctrl+Shift+Esc)
+    TASK_MGR,      // Windows Task Manager (Ctrl+Shift+Esc), Force Quit on Mac
     EEPROM_RESET,  // Reset EEPROM to defaults
 
     // Dual-layer function keys (activates OS-specific FN + Features layer)
     FN_MAC,        // Mac FN key (activates _MAC_FN + _FEATURES)
     FN_WIN,        // Windows FN key (activates _WIN_FN + _FEATURES)
 
+    // Special layer exit (tap: ESC, double-tap: leave the layer)
+    LAYER_EXIT,
+
+    // Host-aware zoom (Cmd or Ctrl + plus/minus, see features/host_profile.h)
+    ZOOM_IN,
+    ZOOM_OUT,
+
     // Safe range for keyboard-specific keycodes
     MOCKLOGIC_SAFE_RANGE
 };
 
-// Tap Dance declarations
-enum {
-    TD_ESC_MOUSE,   // Double-tap ESC to exit mouse layer
-    TD_ESC_KIDDO,   // Double-tap ESC to exit kiddo layer
-    TD_ESC_RGB,     // Double-tap ESC to exit RGB config layer
-    TD_ESC_GAMING   // Double-tap ESC to exit gaming layer
-};
-
 // Shorter aliases
 #define KC_MCTL KC_MISSION_CONTROL
 #define KC_LPAD KC_LAUNCHPAD
@@ -97,7 +104,9 @@ typedef union {
         bool     autocorrect_enabled :1;
         bool     mouse_jiggler_enabled :1;
         uint8_t  active_rgb_preset :2;  // 0-3 for 4 presets
-        uint8_t  reserved :4;            // Reserved for future use
+        uint8_t  host_override :2;       // host_override_t (0 = follow switch/detection)
+        bool     rgb_preset_speed_wpm :1; // Preset 4 speed follows WPM
+        bool     rgb_preset_mode_v2 :1;  // rgb_preset_mode uses the userspace effect numbering
         // RGB Preset 4 (F8) custom configuration (5 bytes = 40 bits)
         uint8_t  rgb_preset_mode;        // RGB effect mode
         uint8_t  rgb_preset_hue;         // Hue (0-255)
@@ -109,11 +118,22 @@ typedef union {
 
 extern userspace_config_t userspace_config;
 
+// EEPROM user datablock layout (EECONFIG_USER_DATA_SIZE bytes, see config.h)
+// Each feature owns a fixed region - bump EECONFIG_USER_DATA_VERSION when this changes
+#define DATABLOCK_AUTOCORRECT_STATS_OFFSET 0
+#define DATABLOCK_AUTOCORRECT_STATS_SIZE   224
+#define DATABLOCK_WHACK_A_MOLE_OFFSET      (DATABLOCK_AUTOCORRECT_STATS_OFFSET + DATABLOCK_AUTOCORRECT_STATS_SIZE)
+#define DATABLOCK_WHACK_A_MOLE_SIZE        8
+#define DATABLOCK_KEY_USAGE_OFFSET         (DATABLOCK_WHACK_A_MOLE_OFFSET + DATABLOCK_WHACK_A_MOLE_SIZE)
+#define DATABLOCK_KEY_USAGE_SIZE           448  // KEY_USAGE_MAX_KEYS x uint32_t
+#define DATABLOCK_END                      (DATABLOCK_KEY_USAGE_OFFSET + DATABLOCK_KEY_USAGE_SIZE)
+
 // Function declarations
-void eeconfig_init_user_datablock(void);
 void keyboard_post_init_user_rgb(void);
 void userspace_config_save(void);
 void userspace_config_load(void);
+void userspace_datablock_read(void *data, uint16_t offset, uint16_t size);
+void userspace_datablock_write(const void *data, uint16_t offset, uint16_t size);
 
 // Feature: Select Word
 bool process_select_word(uint16_t keycode, keyrecord_t* record, uint16_t sel_keycode);
@@ -123,9 +143,18 @@ void rgb_preset_apply(uint8_t preset);
 void rgb_preset_init(void);
 
 // Feature: Mouse Jiggler
+#ifndef MOUSE_JIGGLER_INTERVAL
+    #define MOUSE_JIGGLER_INTERVAL 30000  // ms between nudges
+#endif
+void mouse_jiggler_init(void);
 bool get_mouse_jiggler_enabled(void);
 void set_mouse_jiggler_enabled(bool enabled);
 
+// Feature: Layer Exit
+#ifndef LAYER_EXIT_TAP_TERM
+    #define LAYER_EXIT_TAP_TERM TAPPING_TERM  // ms between the two taps
+#endif
+
 // Feature: Autocorrect
 bool get_autocorrect_enabled(void);
 void set_autocorrect_enabled(bool enabled);
@@ -137,3 +166,5 @@ void rgb_matrix_indicators_mouse_layer(void);
 void rgb_matrix_indicators_kiddo_layer(void);
 void rgb_matrix_indicators_rgb_layer(void);
 void rgb_matrix_indicators_leader_layer(void);
+void rgb_indicators_init(void);
+void rgb_indicators_set_layers(layer_state_t state);
@@ -3,9 +3,9 @@
 
 # Core Features
 LEADER_ENABLE = yes
-TAP_DANCE_ENABLE = yes
 MOUSEKEY_ENABLE = yes
 EXTRAKEY_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
 
 # Disable unused features to save space
 CAPS_WORD_ENABLE = no
@@ -19,10 +19,61 @@ AUTOCORRECT_ENABLE = yes
 AUTOCORRECT_DATA = $(USER_PATH)/autocorrect_data.txt
 
 # Custom feature files
+SRC += $(USER_PATH)/features/scheduler.c
+SRC += $(USER_PATH)/features/multi_tap.c
+SRC += $(USER_PATH)/features/host_profile.c
+SRC += $(USER_PATH)/features/host_leds.c
 SRC += $(USER_PATH)/features/select_word.c
 SRC += $(USER_PATH)/features/rgb_presets.c
+SRC += $(USER_PATH)/features/rgb_idle.c
+SRC += $(USER_PATH)/features/rgb_governor.c
+SRC += $(USER_PATH)/features/rgb_effects.c
+SRC += $(USER_PATH)/features/color_math.c
+SRC += $(USER_PATH)/features/overlay.c
 SRC += $(USER_PATH)/features/whack_a_mole.c
+SRC += $(USER_PATH)/features/autocorrect_stats.c
+SRC += $(USER_PATH)/features/key_usage.c
+SRC += $(USER_PATH)/features/typing_stats.c
 SRC += $(USER_PATH)/mocklogic.c
 
+# Timing probes for hot paths (features/perf.h); Leader + PERF types the report
+MOCKLOGIC_PERF_ENABLE ?= no
+ifeq ($(strip $(MOCKLOGIC_PERF_ENABLE)), yes)
+    OPT_DEFS += -DMOCKLOGIC_PERF_ENABLE
+    SRC += $(USER_PATH)/features/perf.c
+endif
+
+# Key event recorder (features/trace.h); Leader + TRACE types the buffer
+MOCKLOGIC_TRACE_ENABLE ?= no
+ifeq ($(strip $(MOCKLOGIC_TRACE_ENABLE)), yes)
+    OPT_DEFS += -DMOCKLOGIC_TRACE_ENABLE
+    SRC += $(USER_PATH)/features/trace.c
+endif
+
+# Sparse heatmap neighbors per key and their radius (features/rgb_effects.h).
+# Override them here or on the make command line rather than in config.h, so
+# the generated neighbor table below is built for the same values.
+ifdef SPARSE_HEATMAP_NEIGHBORS
+    OPT_DEFS += -DSPARSE_HEATMAP_NEIGHBORS=$(SPARSE_HEATMAP_NEIGHBORS)
+endif
+ifdef SPARSE_HEATMAP_SPREAD_RADIUS
+    OPT_DEFS += -DSPARSE_HEATMAP_SPREAD_RADIUS=$(SPARSE_HEATMAP_SPREAD_RADIUS)
+endif
+
+# Build-time LED map for the RGB indicators (see tools/gen_led_map.py).
+# Skipped with dynamic keymaps, where the keymap can change at runtime.
+ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
+    ifneq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
+        MOCKLOGIC_LED_MAP_H := $(INTERMEDIATE_OUTPUT)/src/mocklogic_led_map.h
+        MOCKLOGIC_LED_MAP_JSON := $(foreach path,$(KEYBOARD_PATHS),$(wildcard $(path)/info.json $(path)/keyboard.json))
+        MOCKLOGIC_LED_MAP_SRC := $(foreach path,$(KEYBOARD_PATHS),$(wildcard $(path)/*.c))
+        $(shell python3 $(USER_PATH)/tools/gen_led_map.py -o $(MOCKLOGIC_LED_MAP_H) --keymap $(KEYMAP_C) \
+            --keyboard $(KEYBOARD) $(addprefix --json ,$(MOCKLOGIC_LED_MAP_JSON)) $(addprefix --source ,$(MOCKLOGIC_LED_MAP_SRC)) \
+            $(addprefix --neighbors ,$(SPARSE_HEATMAP_NEIGHBORS)) $(addprefix --radius ,$(SPARSE_HEATMAP_SPREAD_RADIUS)) 1>&2)
+        VPATH += $(INTERMEDIATE_OUTPUT)/src
+    endif
+endif
+
 # RGB Matrix Features
+RGB_MATRIX_CUSTOM_USER = yes  # rgb_matrix_user.inc (features/rgb_effects.c)
 # RGB_MATRIX_KEYPRESSES = yes  # Disabled - using custom whack-a-mole feedback instead
@@ -0,0 +1,8 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The eeconfig API is part of the stand-in (qmk_host.h)
+
+#pragma once
+
+#include "qmk_host.h"
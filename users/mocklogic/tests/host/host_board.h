@@ -0,0 +1,113 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Test boards for the host tests: each keyboard's layout macro over a plain
+// row-by-row matrix, one row per layout row, with one LED per key in layout
+// order (g_led_config is filled in by qmk_host.c). The Makefile picks the
+// board with KEYBOARD, which also gives the keymap.c under test and the
+// KEYBOARD_<path> defines a QMK build has.
+//
+// tools/led_sim.py passes HOST_BOARD_H instead: a board generated from the
+// keyboard definition in a QMK checkout, with the real matrix and LED layout
+// (HOST_BOARD_LED_CONFIG, used by qmk_host.c in place of the plain one).
+
+#pragma once
+
+#if defined(HOST_BOARD_H)
+
+#    include HOST_BOARD_H
+
+#elif defined(KEYBOARD_keychron_q3)
+
+#    define MATRIX_ROWS 6
+#    define MATRIX_COLS 17
+
+#    define RGB_MATRIX_LED_COUNT 88
+
+#    define NUM_ENCODERS   1
+#    define NUM_DIRECTIONS 2
+
+// clang-format off
+#    define LAYOUT_tkl_f13_ansi( \
+    k00, k01, k02, k03, k04, k05, k06, k07, k08, k09, k0A, k0B, k0C, k0D, k0E, k0F, k0G, \
+    k10, k11, k12, k13, k14, k15, k16, k17, k18, k19, k1A, k1B, k1C, k1D, k1E, k1F, k1G, \
+    k20, k21, k22, k23, k24, k25, k26, k27, k28, k29, k2A, k2B, k2C, k2D, k2E, k2F, k2G, \
+    k30, k31, k32, k33, k34, k35, k36, k37, k38, k39, k3A, k3B, k3C, \
+    k40, k41, k42, k43, k44, k45, k46, k47, k48, k49, k4A, k4B, k4C, \
+    k50, k51, k52, k53, k54, k55, k56, k57, k58, k59, k5A \
+) { \
+    { k00, k01, k02, k03, k04, k05, k06, k07, k08, k09, k0A, k0B, k0C, k0D,   k0E,   k0F,   k0G   }, \
+    { k10, k11, k12, k13, k14, k15, k16, k17, k18, k19, k1A, k1B, k1C, k1D,   k1E,   k1F,   k1G   }, \
+    { k20, k21, k22, k23, k24, k25, k26, k27, k28, k29, k2A, k2B, k2C, k2D,   k2E,   k2F,   k2G   }, \
+    { k30, k31, k32, k33, k34, k35, k36, k37, k38, k39, k3A, k3B, k3C, KC_NO, KC_NO, KC_NO, KC_NO }, \
+    { k40, k41, k42, k43, k44, k45, k46, k47, k48, k49, k4A, k4B, k4C, KC_NO, KC_NO, KC_NO, KC_NO }, \
+    { k50, k51, k52, k53, k54, k55, k56, k57, k58, k59, k5A, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO } \
+}
+// clang-format on
+
+// Keys per row in the layout above (the matrix columns past them are empty)
+#    define HOST_BOARD_ROW_LENGTHS {17, 17, 17, 13, 13, 11}
+
+#elif defined(KEYBOARD_keychron_q1v2)
+
+#    define MATRIX_ROWS 6
+#    define MATRIX_COLS 15
+
+#    define RGB_MATRIX_LED_COUNT 82
+
+#    define NUM_ENCODERS   1
+#    define NUM_DIRECTIONS 2
+
+// clang-format off
+#    define LAYOUT_ansi_82( \
+    k00, k01, k02, k03, k04, k05, k06, k07, k08, k09, k0A, k0B, k0C, k0D, k0E, \
+    k10, k11, k12, k13, k14, k15, k16, k17, k18, k19, k1A, k1B, k1C, k1D, k1E, \
+    k20, k21, k22, k23, k24, k25, k26, k27, k28, k29, k2A, k2B, k2C, k2D, k2E, \
+    k30, k31, k32, k33, k34, k35, k36, k37, k38, k39, k3A, k3B, k3C, k3D, \
+    k40, k41, k42, k43, k44, k45, k46, k47, k48, k49, k4A, k4B, k4C, \
+    k50, k51, k52, k53, k54, k55, k56, k57, k58, k59 \
+) { \
+    { k00, k01, k02, k03, k04, k05, k06, k07, k08, k09, k0A,   k0B,   k0C,   k0D,   k0E   }, \
+    { k10, k11, k12, k13, k14, k15, k16, k17, k18, k19, k1A,   k1B,   k1C,   k1D,   k1E   }, \
+    { k20, k21, k22, k23, k24, k25, k26, k27, k28, k29, k2A,   k2B,   k2C,   k2D,   k2E   }, \
+    { k30, k31, k32, k33, k34, k35, k36, k37, k38, k39, k3A,   k3B,   k3C,   k3D,   KC_NO }, \
+    { k40, k41, k42, k43, k44, k45, k46, k47, k48, k49, k4A,   k4B,   k4C,   KC_NO, KC_NO }, \
+    { k50, k51, k52, k53, k54, k55, k56, k57, k58, k59, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO } \
+}
+// clang-format on
+
+#    define HOST_BOARD_ROW_LENGTHS {15, 15, 15, 14, 13, 10}
+
+#elif defined(KEYBOARD_gmmk_pro)
+
+#    define MATRIX_ROWS 6
+#    define MATRIX_COLS 15
+
+#    define RGB_MATRIX_LED_COUNT 83
+
+#    define NUM_ENCODERS   1
+#    define NUM_DIRECTIONS 2
+
+// clang-format off
+#    define LAYOUT( \
+    k00, k01, k02, k03, k04, k05, k06, k07, k08, k09, k0A, k0B, k0C, k0D, k0E, \
+    k10, k11, k12, k13, k14, k15, k16, k17, k18, k19, k1A, k1B, k1C, k1D, k1E, \
+    k20, k21, k22, k23, k24, k25, k26, k27, k28, k29, k2A, k2B, k2C, k2D, k2E, \
+    k30, k31, k32, k33, k34, k35, k36, k37, k38, k39, k3A, k3B, k3C, k3D, \
+    k40, k41, k42, k43, k44, k45, k46, k47, k48, k49, k4A, k4B, k4C, k4D, \
+    k50, k51, k52, k53, k54, k55, k56, k57, k58, k59 \
+) { \
+    { k00, k01, k02, k03, k04, k05, k06, k07, k08, k09, k0A,   k0B,   k0C,   k0D,   k0E   }, \
+    { k10, k11, k12, k13, k14, k15, k16, k17, k18, k19, k1A,   k1B,   k1C,   k1D,   k1E   }, \
+    { k20, k21, k22, k23, k24, k25, k26, k27, k28, k29, k2A,   k2B,   k2C,   k2D,   k2E   }, \
+    { k30, k31, k32, k33, k34, k35, k36, k37, k38, k39, k3A,   k3B,   k3C,   k3D,   KC_NO }, \
+    { k40, k41, k42, k43, k44, k45, k46, k47, k48, k49, k4A,   k4B,   k4C,   k4D,   KC_NO }, \
+    { k50, k51, k52, k53, k54, k55, k56, k57, k58, k59, KC_NO, KC_NO, KC_NO, KC_NO, KC_NO } \
+}
+// clang-format on
+
+#    define HOST_BOARD_ROW_LENGTHS {15, 15, 15, 14, 14, 10}
+
+#else
+#    error "No host test board for this KEYBOARD (tests/host/host_board.h)"
+#endif
@@ -0,0 +1,18 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// The keymap under test, built into this file the way QMK's
+// keymap_introspection.c does, so the layer count is known at compile time.
+
+#include KEYMAP_C
+
+uint8_t host_keymap_layer_count(void) {
+    return ARRAY_SIZE(keymaps);
+}
+
+uint16_t host_keymap_read(uint8_t layer, uint8_t row, uint8_t col) {
+    if (layer >= ARRAY_SIZE(keymaps) || row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+        return KC_TRNS;
+    }
+    return keymaps[layer][row][col];
+}
@@ -0,0 +1,1163 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// QMK core model for the host tests (see qmk_host.h). Each piece follows the
+// QMK code it stands in for closely enough that the userspace sees the same
+// call order and the same reports, and no further: no matrix scanning, no
+// tapping engine, one LED per key unless the board brings its LED layout.
+
+#include "qmk_host.h"
+#include "autocorrect_data.h"
+#include "color_math.h"
+
+#include <stdio.h>
+#include <time.h>
+
+// -----------------------------------------------------------------------------
+// State
+// -----------------------------------------------------------------------------
+
+uint32_t        host_now;
+layer_state_t   layer_state;
+layer_state_t   default_layer_state;
+keymap_config_t keymap_config;
+led_config_t    g_led_config;
+uint32_t        g_rgb_timer;
+
+host_counts_t host_counts;
+host_report_t host_reports[HOST_REPORT_LOG_SIZE];
+uint16_t      host_report_count;
+char          host_text[HOST_TEXT_SIZE];
+RGB           host_leds[RGB_MATRIX_LED_COUNT];
+
+static uint8_t       real_mods;
+static uint8_t       weak_mods;
+static uint8_t       oneshot_mods;
+static uint8_t       report_keys[6];
+static host_report_t last_report;
+static uint16_t      text_length;
+
+// Layer each held key was pressed on, so its release resolves the same way
+static uint8_t source_layers[MATRIX_ROWS][MATRIX_COLS];
+
+static os_variant_t detected_os;
+static led_t        host_led_state;
+static uint16_t     rand16seed;
+
+typedef struct {
+    bool    enable;
+    uint8_t mode;
+    HSV     hsv;
+    uint8_t speed;
+} rgb_settings_t;
+
+static rgb_settings_t rgb;
+static uint8_t        rendered_mode;  // Effect of the last host_render_frame()
+
+// Persisted across host_reboot(), wiped by host_boot()
+static struct {
+    bool           valid;
+    uint32_t       user;
+    layer_state_t  default_layer;
+    bool           autocorrect;
+    rgb_settings_t rgb;
+    bool           datablock_valid;
+    uint8_t        datablock[EECONFIG_USER_DATA_SIZE];
+} eeprom;
+
+// -----------------------------------------------------------------------------
+// Modifiers
+// -----------------------------------------------------------------------------
+
+uint8_t get_mods(void) {
+    return real_mods;
+}
+void set_mods(uint8_t mods) {
+    real_mods = mods;
+}
+void add_mods(uint8_t mods) {
+    real_mods |= mods;
+}
+void del_mods(uint8_t mods) {
+    real_mods &= ~mods;
+}
+void clear_mods(void) {
+    real_mods = 0;
+}
+uint8_t get_weak_mods(void) {
+    return weak_mods;
+}
+void add_weak_mods(uint8_t mods) {
+    weak_mods |= mods;
+}
+void del_weak_mods(uint8_t mods) {
+    weak_mods &= ~mods;
+}
+uint8_t get_oneshot_mods(void) {
+    return oneshot_mods;
+}
+void clear_oneshot_mods(void) {
+    oneshot_mods = 0;
+}
+
+// -----------------------------------------------------------------------------
+// HID reports and the host's view of them
+// -----------------------------------------------------------------------------
+
+// US layout: HID usage KC_A..KC_SLSH to the unshifted and shifted character
+static const char ascii_lut[][2] = {
+    [KC_A - KC_A] = {'a', 'A'}, [KC_B - KC_A] = {'b', 'B'}, [KC_C - KC_A] = {'c', 'C'}, [KC_D - KC_A] = {'d', 'D'},
+    [KC_E - KC_A] = {'e', 'E'}, [KC_F - KC_A] = {'f', 'F'}, [KC_G - KC_A] = {'g', 'G'}, [KC_H - KC_A] = {'h', 'H'},
+    [KC_I - KC_A] = {'i', 'I'}, [KC_J - KC_A] = {'j', 'J'}, [KC_K - KC_A] = {'k', 'K'}, [KC_L - KC_A] = {'l', 'L'},
+    [KC_M - KC_A] = {'m', 'M'}, [KC_N - KC_A] = {'n', 'N'}, [KC_O - KC_A] = {'o', 'O'}, [KC_P - KC_A] = {'p', 'P'},
+    [KC_Q - KC_A] = {'q', 'Q'}, [KC_R - KC_A] = {'r', 'R'}, [KC_S - KC_A] = {'s', 'S'}, [KC_T - KC_A] = {'t', 'T'},
+    [KC_U - KC_A] = {'u', 'U'}, [KC_V - KC_A] = {'v', 'V'}, [KC_W - KC_A] = {'w', 'W'}, [KC_X - KC_A] = {'x', 'X'},
+    [KC_Y - KC_A] = {'y', 'Y'}, [KC_Z - KC_A] = {'z', 'Z'},
+    [KC_1 - KC_A] = {'1', '!'}, [KC_2 - KC_A] = {'2', '@'}, [KC_3 - KC_A] = {'3', '#'}, [KC_4 - KC_A] = {'4', '$'},
+    [KC_5 - KC_A] = {'5', '%'}, [KC_6 - KC_A] = {'6', '^'}, [KC_7 - KC_A] = {'7', '&'}, [KC_8 - KC_A] = {'8', '*'},
+    [KC_9 - KC_A] = {'9', '('}, [KC_0 - KC_A] = {'0', ')'},
+    [KC_ENT - KC_A] = {'\n', '\n'}, [KC_TAB - KC_A] = {'\t', '\t'}, [KC_SPC - KC_A] = {' ', ' '},
+    [KC_MINS - KC_A] = {'-', '_'}, [KC_EQL - KC_A] = {'=', '+'}, [KC_LBRC - KC_A] = {'[', '{'},
+    [KC_RBRC - KC_A] = {']', '}'}, [KC_BSLS - KC_A] = {'\\', '|'}, [KC_SCLN - KC_A] = {';', ':'},
+    [KC_QUOT - KC_A] = {'\'', '"'}, [KC_GRV - KC_A] = {'`', '~'}, [KC_COMM - KC_A] = {',', '<'},
+    [KC_DOT - KC_A] = {'.', '>'}, [KC_SLSH - KC_A] = {'/', '?'},
+};
+
+static void text_key_down(uint8_t key, uint8_t mods) {
+    if (mods & (MOD_MASK_CTRL | MOD_MASK_ALT | MOD_MASK_GUI)) {
+        return;  // Shortcut, not text
+    }
+    if (key == KC_BSPC) {
+        if (text_length > 0) {
+            host_text[--text_length] = '\0';
+        }
+        return;
+    }
+    if (key < KC_A || key > KC_SLSH) {
+        return;
+    }
+    char c = ascii_lut[key - KC_A][(mods & MOD_MASK_SHIFT) != 0];
+    if (c && text_length < HOST_TEXT_SIZE - 1) {
+        host_text[text_length++] = c;
+        host_text[text_length]   = '\0';
+    }
+}
+
+static bool report_has_key(const host_report_t *report, uint8_t key) {
+    for (uint8_t i = 0; i < sizeof(report->keys); i++) {
+        if (report->keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void add_key(uint8_t key) {
+    uint8_t *free_slot = NULL;
+    for (uint8_t i = 0; i < sizeof(report_keys); i++) {
+        if (report_keys[i] == key) {
+            return;
+        }
+        if (!report_keys[i] && !free_slot) {
+            free_slot = &report_keys[i];
+        }
+    }
+    if (free_slot) {
+        *free_slot = key;
+    }
+}
+
+void del_key(uint8_t key) {
+    for (uint8_t i = 0; i < sizeof(report_keys); i++) {
+        if (report_keys[i] == key) {
+            report_keys[i] = 0;
+        }
+    }
+}
+
+void clear_keys(void) {
+    memset(report_keys, 0, sizeof(report_keys));
+}
+
+// Like QMK, a report identical to the previous one is not sent
+void send_keyboard_report(void) {
+    host_report_t report = {.mods = real_mods | weak_mods};
+    memcpy(report.keys, report_keys, sizeof(report.keys));
+    if (memcmp(&report, &last_report, sizeof(report)) == 0) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < sizeof(report.keys); i++) {
+        if (report.keys[i] && !report_has_key(&last_report, report.keys[i])) {
+            text_key_down(report.keys[i], report.mods);
+        }
+    }
+    last_report = report;
+
+    host_counts.hid_reports++;
+    if (host_report_count < HOST_REPORT_LOG_SIZE) {
+        host_reports[host_report_count++] = report;
+    }
+}
+
+static const char *key_name(uint8_t key, char *buf, size_t size) {
+    static const struct {
+        uint8_t     key;
+        const char *name;
+    } names[] = {
+        {KC_ENT, "ENT"},   {KC_ESC, "ESC"},   {KC_BSPC, "BSPC"}, {KC_TAB, "TAB"},   {KC_SPC, "SPC"},
+        {KC_PSCR, "PSCR"}, {KC_INS, "INS"},   {KC_HOME, "HOME"}, {KC_PGUP, "PGUP"}, {KC_DEL, "DEL"},
+        {KC_END, "END"},   {KC_PGDN, "PGDN"}, {KC_RGHT, "RGHT"}, {KC_LEFT, "LEFT"}, {KC_DOWN, "DOWN"},
+        {KC_UP, "UP"},
+    };
+    for (uint8_t i = 0; i < ARRAY_SIZE(names); i++) {
+        if (names[i].key == key) {
+            return names[i].name;
+        }
+    }
+    if (key >= KC_A && key <= KC_Z) {
+        snprintf(buf, size, "%c", 'A' + (key - KC_A));
+    } else if (key >= KC_1 && key <= KC_0) {
+        snprintf(buf, size, "%c", "1234567890"[key - KC_1]);
+    } else if (key >= KC_F1 && key <= KC_F12) {
+        snprintf(buf, size, "F%d", key - KC_F1 + 1);
+    } else {
+        snprintf(buf, size, "0x%02X", key);
+    }
+    return buf;
+}
+
+int host_format_report(const host_report_t *report, char *buf, size_t size) {
+    static const char mod_names[] = "CSAGcsag";
+
+    char   word[64];
+    size_t length = 0;
+    for (uint8_t i = 0; i < 8; i++) {
+        if (report->mods & (1 << i)) {
+            word[length++] = mod_names[i];
+        }
+    }
+    for (uint8_t i = 0; i < sizeof(report->keys); i++) {
+        if (report->keys[i] != KC_NO) {
+            char name[8];
+            length += snprintf(word + length, sizeof(word) - length, "%s%s", length ? "+" : "", key_name(report->keys[i], name, sizeof(name)));
+        }
+    }
+    word[length] = '\0';
+    return snprintf(buf, size, "%s", length ? word : "-");
+}
+
+void register_code(uint8_t code) {
+    if (IS_MODIFIER_KEYCODE(code)) {
+        add_mods(MOD_BIT(code));
+    } else if (IS_BASIC_KEYCODE(code)) {
+        add_key(code);
+    } else {
+        return;  // System, consumer and mouse keys use other reports
+    }
+    send_keyboard_report();
+}
+
+void unregister_code(uint8_t code) {
+    if (IS_MODIFIER_KEYCODE(code)) {
+        del_mods(MOD_BIT(code));
+    } else if (IS_BASIC_KEYCODE(code)) {
+        del_key(code);
+    } else {
+        return;
+    }
+    send_keyboard_report();
+}
+
+void tap_code(uint8_t code) {
+    register_code(code);
+    unregister_code(code);
+}
+
+// 5-bit mods of a 16-bit keycode to the 8-bit report mods
+static uint8_t code16_mods(uint16_t code) {
+    uint8_t mods = QK_MODS_GET_MODS(code);
+    return (mods & 0x10) ? (mods & 0x0F) << 4 : mods;
+}
+
+void register_code16(uint16_t code) {
+    uint8_t mods = code16_mods(code);
+    if (mods) {
+        uint8_t key = QK_MODS_GET_BASIC_KEYCODE(code);
+        if (IS_MODIFIER_KEYCODE(key) || key == KC_NO) {
+            add_mods(mods);
+        } else {
+            add_weak_mods(mods);
+        }
+        send_keyboard_report();
+    }
+    register_code(code);
+}
+
+void unregister_code16(uint16_t code) {
+    unregister_code(code);
+    uint8_t mods = code16_mods(code);
+    if (mods) {
+        uint8_t key = QK_MODS_GET_BASIC_KEYCODE(code);
+        if (IS_MODIFIER_KEYCODE(key) || key == KC_NO) {
+            del_mods(mods);
+        } else {
+            del_weak_mods(mods);
+        }
+        send_keyboard_report();
+    }
+}
+
+void tap_code16(uint16_t code) {
+    register_code16(code);
+    unregister_code16(code);
+}
+
+void send_char(char ascii) {
+    for (uint8_t i = 0; i < ARRAY_SIZE(ascii_lut); i++) {
+        for (uint8_t shift = 0; shift < 2; shift++) {
+            if (ascii_lut[i][shift] != ascii) {
+                continue;
+            }
+            if (shift) {
+                register_code(KC_LSFT);
+            }
+            tap_code(KC_A + i);
+            if (shift) {
+                unregister_code(KC_LSFT);
+            }
+            return;
+        }
+    }
+}
+
+void send_string(const char *string) {
+    while (*string) {
+        send_char(*string++);
+    }
+}
+
+const char *get_numeric_str(char *buf, size_t size, uint32_t value, char pad) {
+    buf[size - 1] = '\0';
+    for (size_t i = 0; i < size - 1; i++) {
+        char c            = '0' + value % 10;
+        buf[size - 2 - i] = (c == '0' && i == 0) ? '0' : (value > 0 ? c : pad);
+        value /= 10;
+    }
+    return buf;
+}
+
+const char *get_u8_str(uint8_t value, char pad) {
+    static char buf[4];
+    return get_numeric_str(buf, sizeof(buf), value, pad);
+}
+
+const char *get_u16_str(uint16_t value, char pad) {
+    static char buf[6];
+    return get_numeric_str(buf, sizeof(buf), value, pad);
+}
+
+led_t host_keyboard_led_state(void) {
+    return host_led_state;
+}
+
+// -----------------------------------------------------------------------------
+// Timer
+// -----------------------------------------------------------------------------
+
+// Blocking wait: time passes, nothing else runs
+void wait_ms(uint32_t ms) {
+    host_now += ms;
+}
+
+// -----------------------------------------------------------------------------
+// Hook timing
+// -----------------------------------------------------------------------------
+
+host_hook_time_t host_hook_times[HOST_HOOK_COUNT];
+
+const char *const host_hook_names[HOST_HOOK_COUNT] = {
+    [HOST_HOOK_PROCESS_RECORD_USER]  = "process_record_user",
+    [HOST_HOOK_LAYER_STATE_SET_USER] = "layer_state_set_user",
+    [HOST_HOOK_LEADER_END_USER]      = "leader_end_user",
+};
+
+static uint64_t hook_clock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void hook_done(host_hook_t hook, uint64_t start) {
+    uint64_t          elapsed = hook_clock() - start;
+    host_hook_time_t *t       = &host_hook_times[hook];
+    if (t->count == 0 || elapsed < t->min_ns) {
+        t->min_ns = elapsed;
+    }
+    if (elapsed > t->max_ns) {
+        t->max_ns = elapsed;
+    }
+    t->total_ns += elapsed;
+    t->count++;
+}
+
+// -----------------------------------------------------------------------------
+// Layers and keymap
+// -----------------------------------------------------------------------------
+
+uint8_t get_highest_layer(layer_state_t state) {
+    return state ? 31 - __builtin_clz(state) : 0;
+}
+
+bool layer_state_is(uint8_t layer) {
+    return layer_state_cmp(layer_state, layer);
+}
+
+bool layer_state_cmp(layer_state_t state, uint8_t layer) {
+    return state ? (state & ((layer_state_t)1 << layer)) != 0 : layer == 0;
+}
+
+void layer_state_set(layer_state_t state) {
+    uint64_t start = hook_clock();
+    state          = layer_state_set_user(state);
+    hook_done(HOST_HOOK_LAYER_STATE_SET_USER, start);
+    layer_state = state;
+}
+
+void layer_clear(void) {
+    layer_state_set(0);
+}
+
+void layer_move(uint8_t layer) {
+    layer_state_set((layer_state_t)1 << layer);
+}
+
+void layer_on(uint8_t layer) {
+    layer_state_set(layer_state | ((layer_state_t)1 << layer));
+}
+
+void layer_off(uint8_t layer) {
+    layer_state_set(layer_state & ~((layer_state_t)1 << layer));
+}
+
+void layer_or(layer_state_t state) {
+    layer_state_set(layer_state | state);
+}
+
+void layer_and(layer_state_t state) {
+    layer_state_set(layer_state & state);
+}
+
+void default_layer_set(layer_state_t state) {
+    state               = default_layer_state_set_user(state);
+    default_layer_state = state;
+}
+
+void set_single_persistent_default_layer(uint8_t layer) {
+    eeconfig_update_default_layer((layer_state_t)1 << layer);
+    default_layer_set((layer_state_t)1 << layer);
+}
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key) {
+    host_counts.keymap_reads++;
+    return host_keymap_read(layer, key.row, key.col);
+}
+
+// Highest active layer that does not pass the key through
+static uint8_t resolve_layer(uint8_t row, uint8_t col) {
+    layer_state_t state = layer_state | default_layer_state;
+    for (int8_t layer = host_keymap_layer_count() - 1; layer >= 0; layer--) {
+        if ((state & ((layer_state_t)1 << layer)) && host_keymap_read(layer, row, col) != KC_TRNS) {
+            return layer;
+        }
+    }
+    return 0;
+}
+
+uint16_t host_keycode_at(uint8_t row, uint8_t col) {
+    return host_keymap_read(resolve_layer(row, col), row, col);
+}
+
+bool host_find_key(uint8_t layer, uint16_t keycode, keypos_t *pos) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (host_keymap_read(layer, row, col) == keycode) {
+                *pos = (keypos_t){.col = col, .row = row};
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+// EEPROM
+// -----------------------------------------------------------------------------
+
+static const rgb_settings_t rgb_defaults = {
+    .enable = true,
+    .mode   = RGB_MATRIX_SOLID_COLOR,
+    .hsv    = {0, 255, 255},
+    .speed  = 128,
+};
+
+void eeconfig_init(void) {
+    eeprom.valid         = true;
+    eeprom.user          = 0;
+    eeprom.default_layer = (layer_state_t)1 << 0;
+    eeprom.autocorrect   = true;
+    eeprom.rgb           = rgb_defaults;
+    eeconfig_init_user_datablock();
+    eeconfig_init_user();
+}
+
+uint32_t eeconfig_read_user(void) {
+    return eeprom.user;
+}
+
+void eeconfig_update_user(uint32_t value) {
+    host_counts.eeprom_writes++;
+    eeprom.user = value;
+}
+
+void eeconfig_update_default_layer(layer_state_t state) {
+    host_counts.eeprom_writes++;
+    eeprom.default_layer = state;
+}
+
+bool eeconfig_is_user_datablock_valid(void) {
+    return eeprom.datablock_valid;
+}
+
+void eeconfig_init_user_datablock(void) {
+    memset(eeprom.datablock, 0, sizeof(eeprom.datablock));
+    eeprom.datablock_valid = true;
+}
+
+uint32_t eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) {
+    if (offset + length > sizeof(eeprom.datablock)) {
+        return 0;
+    }
+    memcpy(data, eeprom.datablock + offset, length);
+    return length;
+}
+
+uint32_t eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) {
+    host_counts.eeprom_writes++;
+    if (offset + length > sizeof(eeprom.datablock)) {
+        return 0;
+    }
+    memcpy(eeprom.datablock + offset, data, length);
+    return length;
+}
+
+void soft_reset_keyboard(void) {
+    host_counts.soft_resets++;
+}
+
+// -----------------------------------------------------------------------------
+// Deferred execution
+// -----------------------------------------------------------------------------
+
+#define HOST_DEFERRED_SLOTS 16
+
+static struct {
+    deferred_token         token;
+    uint32_t               trigger_time;
+    deferred_exec_callback callback;
+    void                  *cb_arg;
+} deferred[HOST_DEFERRED_SLOTS];
+
+static deferred_token last_token;
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
+    if (delay_ms == 0 || !callback) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+    for (uint8_t i = 0; i < HOST_DEFERRED_SLOTS; i++) {
+        if (deferred[i].token == INVALID_DEFERRED_TOKEN) {
+            if (++last_token == INVALID_DEFERRED_TOKEN) {
+                ++last_token;
+            }
+            deferred[i].token        = last_token;
+            deferred[i].trigger_time = timer_read32() + delay_ms;
+            deferred[i].callback     = callback;
+            deferred[i].cb_arg       = cb_arg;
+            return last_token;
+        }
+    }
+    return INVALID_DEFERRED_TOKEN;
+}
+
+bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
+    for (uint8_t i = 0; token != INVALID_DEFERRED_TOKEN && i < HOST_DEFERRED_SLOTS; i++) {
+        if (deferred[i].token == token) {
+            deferred[i].trigger_time = timer_read32() + delay_ms;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool cancel_deferred_exec(deferred_token token) {
+    for (uint8_t i = 0; token != INVALID_DEFERRED_TOKEN && i < HOST_DEFERRED_SLOTS; i++) {
+        if (deferred[i].token == token) {
+            deferred[i].token = INVALID_DEFERRED_TOKEN;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void deferred_exec_task(void) {
+    uint32_t now = timer_read32();
+    for (uint8_t i = 0; i < HOST_DEFERRED_SLOTS; i++) {
+        if (deferred[i].token == INVALID_DEFERRED_TOKEN || !timer_expired32(now, deferred[i].trigger_time)) {
+            continue;
+        }
+        deferred_token token = deferred[i].token;
+        uint32_t       delay = deferred[i].callback(deferred[i].trigger_time, deferred[i].cb_arg);
+        // The callback may have cancelled itself, or cancelled and reused the slot
+        if (deferred[i].token != token) {
+            continue;
+        }
+        if (delay == 0) {
+            deferred[i].token = INVALID_DEFERRED_TOKEN;
+        } else {
+            deferred[i].trigger_time += delay;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Leader (quantum/leader.c with LEADER_PER_KEY_TIMING and LEADER_NO_TIMEOUT)
+// -----------------------------------------------------------------------------
+
+static struct {
+    bool     leading;
+    uint16_t time;
+    uint16_t sequence[5];
+    uint8_t  size;
+} leader;
+
+bool leader_sequence_active(void) {
+    return leader.leading;
+}
+
+static bool leader_sequence_is(uint8_t size, uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
+    const uint16_t keys[5] = {kc1, kc2, kc3, kc4, kc5};
+    return leader.size == size && memcmp(leader.sequence, keys, sizeof(keys)) == 0;
+}
+
+bool leader_sequence_one_key(uint16_t kc1) {
+    return leader_sequence_is(1, kc1, 0, 0, 0, 0);
+}
+bool leader_sequence_two_keys(uint16_t kc1, uint16_t kc2) {
+    return leader_sequence_is(2, kc1, kc2, 0, 0, 0);
+}
+bool leader_sequence_three_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3) {
+    return leader_sequence_is(3, kc1, kc2, kc3, 0, 0);
+}
+bool leader_sequence_four_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4) {
+    return leader_sequence_is(4, kc1, kc2, kc3, kc4, 0);
+}
+bool leader_sequence_five_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5) {
+    return leader_sequence_is(5, kc1, kc2, kc3, kc4, kc5);
+}
+
+static void leader_start(void) {
+    if (leader.leading) {
+        return;
+    }
+    leader_start_user();
+    leader.leading = true;
+    leader.time    = timer_read();
+    leader.size    = 0;
+    memset(leader.sequence, 0, sizeof(leader.sequence));
+}
+
+static void leader_end(void) {
+    leader.leading = false;
+    uint64_t start = hook_clock();
+    leader_end_user();
+    hook_done(HOST_HOOK_LEADER_END_USER, start);
+}
+
+static bool leader_timed_out(void) {
+    return leader.size > 0 && timer_elapsed(leader.time) > LEADER_TIMEOUT;
+}
+
+static bool process_leader(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return true;
+    }
+    if (leader.leading && !leader_timed_out()) {
+        if (leader.size >= ARRAY_SIZE(leader.sequence)) {
+            leader_end();
+            return true;
+        }
+        leader.sequence[leader.size++] = keycode;
+        leader.time                    = timer_read();
+        return false;
+    }
+    if (keycode == QK_LEAD) {
+        leader_start();
+    }
+    return true;
+}
+
+static void leader_task(void) {
+    if (leader.leading && leader_timed_out()) {
+        leader_end();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Autocorrect (quantum/process_keycode/process_autocorrect.c, trie from
+// autocorrect_data.h)
+// -----------------------------------------------------------------------------
+
+static uint8_t typo_buffer[AUTOCORRECT_MAX_LENGTH] = {KC_SPC};
+static uint8_t typo_buffer_size                    = 1;
+
+// The switch lives in the persisted keymap config, as in QMK
+static void autocorrect_save(bool enabled) {
+    host_counts.eeprom_writes++;
+    eeprom.autocorrect = enabled;
+}
+
+void autocorrect_enable(void) {
+    autocorrect_save(true);
+}
+
+void autocorrect_disable(void) {
+    autocorrect_save(false);
+    typo_buffer_size = 0;
+}
+
+bool autocorrect_is_enabled(void) {
+    return eeprom.autocorrect;
+}
+
+// The typo is the last word in the buffer; the correction replaces its last
+// characters the way the backspaces and changes do on screen
+static void apply_correction(uint8_t backspaces, const char *changes) {
+    char    typo[AUTOCORRECT_MAX_LENGTH + 1]     = {0};
+    char    correct[AUTOCORRECT_MAX_LENGTH + 10] = {0};
+    bool    space_last = typo_buffer[typo_buffer_size - 1] == KC_SPC;
+    uint8_t end        = typo_buffer_size - space_last;
+    uint8_t start      = end;
+    while (start > 0 && typo_buffer[start - 1] != KC_SPC) {
+        start--;
+    }
+    for (uint8_t i = start; i < end; i++) {
+        typo[i - start] = 'a' + typo_buffer[i] - KC_A;
+    }
+
+    // Characters of the word already on screen (a letter that triggers is not)
+    uint8_t shown = end - start - !space_last;
+    uint8_t kept  = shown > backspaces ? shown - backspaces : 0;
+    memcpy(correct, typo, kept);
+    strncat(correct, changes, sizeof(correct) - kept - 1);
+
+    if (apply_autocorrect(backspaces, changes, typo, correct)) {
+        for (uint8_t i = 0; i < backspaces; i++) {
+            tap_code(KC_BSPC);
+        }
+        send_string(changes);
+    }
+}
+
+static bool process_autocorrect(uint16_t keycode, keyrecord_t *record) {
+    uint8_t mods = get_mods() | get_oneshot_mods();
+
+    if (!record->event.pressed) {
+        return true;
+    }
+    if (!autocorrect_is_enabled()) {
+        typo_buffer_size = 0;
+        return true;
+    }
+    if (!process_autocorrect_user(&keycode, record, &typo_buffer_size, &mods)) {
+        return true;
+    }
+
+    // Shortcuts and non-letters end the word
+    if (mods & ~MOD_MASK_SHIFT) {
+        typo_buffer_size = 0;
+        return true;
+    }
+    if (!(KC_A <= keycode && keycode <= KC_Z)) {
+        if (keycode == KC_BSPC) {
+            if (typo_buffer_size > 0) {
+                typo_buffer_size--;
+            }
+            return true;
+        } else if (KC_1 <= keycode && keycode <= KC_SLSH && keycode != KC_ESC) {
+            keycode = KC_SPC;  // Word boundary
+        } else {
+            typo_buffer_size = 0;
+            return true;
+        }
+    }
+
+    if (typo_buffer_size >= AUTOCORRECT_MAX_LENGTH) {
+        memmove(typo_buffer, typo_buffer + 1, AUTOCORRECT_MAX_LENGTH - 1);
+        typo_buffer_size = AUTOCORRECT_MAX_LENGTH - 1;
+    }
+    typo_buffer[typo_buffer_size++] = keycode;
+
+    // Walk the trie from the last character backwards
+    uint16_t state = 0;
+    uint16_t code  = pgm_read_byte(autocorrect_data + state);
+    for (int8_t i = typo_buffer_size - 1; i >= 0; --i) {
+        uint8_t const key_i = typo_buffer[i];
+
+        if (code & 64) {  // Node with several children
+            code &= 63;
+            for (; code != key_i; code = pgm_read_byte(autocorrect_data + (state += 3))) {
+                if (!code) {
+                    return true;
+                }
+            }
+            state = pgm_read_byte(autocorrect_data + state + 1) | pgm_read_byte(autocorrect_data + state + 2) << 8;
+        } else if (code != key_i) {  // Node with a single child
+            return true;
+        } else if (!(code = pgm_read_byte(autocorrect_data + (++state)))) {
+            ++state;
+        }
+
+        if (state >= DICTIONARY_SIZE) {
+            return true;
+        }
+        code = pgm_read_byte(autocorrect_data + state);
+
+        if (code & 128) {  // Typo found
+            apply_correction((code & 63) + !record->event.pressed, (const char *)(autocorrect_data + state + 1));
+            if (keycode == KC_SPC) {
+                typo_buffer[0]   = KC_SPC;
+                typo_buffer_size = 1;
+                return true;
+            }
+            typo_buffer_size = 0;
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// OS detection, random numbers
+// -----------------------------------------------------------------------------
+
+os_variant_t detected_host_os(void) {
+    return detected_os;
+}
+
+void host_detect_os(os_variant_t os) {
+    detected_os = os;
+    process_detected_host_os_user(os);
+}
+
+// lib8tion random16_set_seed() and random8()
+void random16_set_seed(uint16_t seed) {
+    rand16seed = seed;
+}
+
+uint8_t random8(void) {
+    rand16seed = (rand16seed * 2053) + 13849;
+    return (uint8_t)((rand16seed & 0xFF) + (rand16seed >> 8));
+}
+
+// -----------------------------------------------------------------------------
+// RGB matrix settings
+// -----------------------------------------------------------------------------
+
+void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
+    if (index >= 0 && index < RGB_MATRIX_LED_COUNT) {
+        host_leds[index] = (RGB){red, green, blue};
+    }
+}
+
+void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        host_leds[i] = (RGB){red, green, blue};
+    }
+}
+
+void rgb_matrix_enable(void) {
+    rgb.enable        = true;
+    eeprom.rgb.enable = true;
+}
+
+void rgb_matrix_enable_noeeprom(void) {
+    rgb.enable = true;
+}
+
+void rgb_matrix_disable_noeeprom(void) {
+    rgb.enable = false;
+}
+
+bool rgb_matrix_is_enabled(void) {
+    return rgb.enable;
+}
+
+// Like QMK, mode, color and speed changes are dropped while the matrix is off
+static void rgb_set_mode(uint8_t mode, bool write_to_eeprom) {
+    if (!rgb.enable) {
+        return;
+    }
+    rgb.mode = mode < 1 ? 1 : (mode >= RGB_MATRIX_EFFECT_MAX ? RGB_MATRIX_EFFECT_MAX - 1 : mode);
+    if (write_to_eeprom) {
+        eeprom.rgb.mode = rgb.mode;
+    }
+}
+
+void rgb_matrix_mode(uint8_t mode) {
+    host_counts.rgb_mode++;
+    rgb_set_mode(mode, true);
+}
+
+void rgb_matrix_mode_noeeprom(uint8_t mode) {
+    host_counts.rgb_mode_noeeprom++;
+    rgb_set_mode(mode, false);
+}
+
+uint8_t rgb_matrix_get_mode(void) {
+    return rgb.mode;
+}
+
+static void rgb_set_hsv(uint8_t hue, uint8_t sat, uint8_t val, bool write_to_eeprom) {
+    if (!rgb.enable) {
+        return;
+    }
+    rgb.hsv = (HSV){hue, sat, val};
+    if (write_to_eeprom) {
+        eeprom.rgb.hsv = rgb.hsv;
+    }
+}
+
+void rgb_matrix_sethsv(uint8_t hue, uint8_t sat, uint8_t val) {
+    rgb_set_hsv(hue, sat, val, true);
+}
+
+void rgb_matrix_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val) {
+    rgb_set_hsv(hue, sat, val, false);
+}
+
+HSV rgb_matrix_get_hsv(void) {
+    return rgb.hsv;
+}
+
+uint8_t rgb_matrix_get_val(void) {
+    return rgb.hsv.v;
+}
+
+void rgb_matrix_set_speed(uint8_t speed) {
+    rgb.speed        = speed;
+    eeprom.rgb.speed = speed;
+}
+
+void rgb_matrix_set_speed_noeeprom(uint8_t speed) {
+    rgb.speed = speed;
+}
+
+uint8_t rgb_matrix_get_speed(void) {
+    return rgb.speed;
+}
+
+void host_render_indicators(void) {
+    g_rgb_timer = host_now;
+    memset(host_leds, 0, sizeof(host_leds));
+    rgb_matrix_indicators_advanced_user(0, RGB_MATRIX_LED_COUNT);
+}
+
+// The userspace effects, registered the way rgb_matrix.c does
+#define RGB_MATRIX_EFFECT(name)
+#define RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#include "rgb_matrix_user.inc"
+#undef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
+#undef RGB_MATRIX_EFFECT
+
+void host_render_frame(void) {
+    g_rgb_timer = host_now;
+    memset(host_leds, 0, sizeof(host_leds));
+    if (!rgb.enable) {
+        return;
+    }
+
+    effect_params_t params = {.iter = 0, .flags = LED_FLAG_ALL, .init = rgb.mode != rendered_mode};
+    rendered_mode          = rgb.mode;
+    switch (rgb.mode) {
+        case RGB_MATRIX_SOLID_COLOR: {
+            RGB c = color_hsv_to_rgb(rgb.hsv);
+            rgb_matrix_set_color_all(c.r, c.g, c.b);
+            break;
+        }
+        case RGB_MATRIX_CUSTOM_sparse_heatmap:
+            sparse_heatmap(&params);
+            break;
+        case RGB_MATRIX_CUSTOM_column_rain:
+            column_rain(&params);
+            break;
+        default:
+            break;  // QMK's own animations are not modeled
+    }
+    rgb_matrix_indicators_advanced_user(0, RGB_MATRIX_LED_COUNT);
+}
+
+// -----------------------------------------------------------------------------
+// Key pipeline and main loop
+// -----------------------------------------------------------------------------
+
+// quantum.c: the user hook first, then the core features, then the keycode's
+// own action
+static void process_record(uint16_t keycode, keyrecord_t *record) {
+    uint64_t start = hook_clock();
+    bool     keep  = process_record_user(keycode, record);
+    hook_done(HOST_HOOK_PROCESS_RECORD_USER, start);
+    if (!keep) {
+        return;
+    }
+    if (!process_leader(keycode, record)) {
+        return;
+    }
+    if (!process_autocorrect(keycode, record)) {
+        return;
+    }
+
+    bool pressed = record->event.pressed;
+    if (IS_BASIC_KEYCODE(keycode) || IS_MODIFIER_KEYCODE(keycode)) {
+        pressed ? register_code(keycode) : unregister_code(keycode);
+    } else if (IS_QK_MODS(keycode)) {
+        pressed ? register_code16(keycode) : unregister_code16(keycode);
+    } else if ((keycode & ~0x1F) == QK_MOMENTARY) {
+        pressed ? layer_on(keycode & 0x1F) : layer_off(keycode & 0x1F);
+    } else if (keycode == NK_TOGG && pressed) {
+        keymap_config.nkro = !keymap_config.nkro;
+    }
+}
+
+void host_key_event(uint8_t row, uint8_t col, bool pressed) {
+    keyrecord_t record = {
+        .event = {
+            .key     = {.col = col, .row = row},
+            .time    = timer_read() | 1,  // 0 means "no event" to QMK
+            .type    = KEY_EVENT,
+            .pressed = pressed,
+        },
+    };
+    if (pressed) {
+        source_layers[row][col] = resolve_layer(row, col);
+    }
+    process_record(host_keymap_read(source_layers[row][col], row, col), &record);
+}
+
+void host_idle(uint32_t ms) {
+    while (ms--) {
+        host_now++;
+        deferred_exec_task();
+        leader_task();
+        housekeeping_task_user();
+    }
+}
+
+void host_tap_key(uint8_t layer, uint16_t keycode, uint32_t hold_ms, uint32_t gap_ms) {
+    keypos_t pos;
+    if (!host_find_key(layer, keycode, &pos)) {
+        return;
+    }
+    host_key_event(pos.row, pos.col, true);
+    host_idle(hold_ms);
+    host_key_event(pos.row, pos.col, false);
+    host_idle(gap_ms);
+}
+
+void host_type(const char *text) {
+    uint8_t base = get_highest_layer(default_layer_state);
+    for (; *text; text++) {
+        uint16_t keycode = KC_NO;
+        if (*text >= 'a' && *text <= 'z') {
+            keycode = KC_A + (*text - 'a');
+        } else if (*text >= '1' && *text <= '9') {
+            keycode = KC_1 + (*text - '1');
+        } else if (*text == '0') {
+            keycode = KC_0;
+        } else if (*text == ' ') {
+            keycode = KC_SPC;
+        }
+        host_tap_key(base, keycode, 30, 70);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Boot
+// -----------------------------------------------------------------------------
+
+// The generated board's own g_led_config, else one LED per key in layout
+// order, on a 224x64 grid like QMK's
+static void board_init(void) {
+#ifdef HOST_BOARD_LED_CONFIG
+    static const led_config_t board = HOST_BOARD_LED_CONFIG;
+    g_led_config                    = board;
+#else
+    static const uint8_t row_lengths[MATRIX_ROWS] = HOST_BOARD_ROW_LENGTHS;
+
+    memset(&g_led_config, 0, sizeof(g_led_config));
+    uint8_t led = 0;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (col >= row_lengths[row]) {
+                g_led_config.matrix_co[row][col] = NO_LED;
+                continue;
+            }
+            g_led_config.matrix_co[row][col] = led;
+            g_led_config.point[led]          = (led_point_t){col * 224 / (MATRIX_COLS - 1), row * 64 / (MATRIX_ROWS - 1)};
+            g_led_config.flags[led]          = (col == 0 || row == MATRIX_ROWS - 1) ? LED_FLAG_MODIFIER : LED_FLAG_KEYLIGHT;
+            led++;
+        }
+    }
+#endif
+}
+
+void host_clear_log(void) {
+    memset(&host_counts, 0, sizeof(host_counts));
+    memset(host_hook_times, 0, sizeof(host_hook_times));
+    host_report_count = 0;
+    text_length       = 0;
+    host_text[0]      = '\0';
+}
+
+void host_reboot(void) {
+    host_clear_log();
+    host_now            = 0;
+    layer_state         = 0;
+    default_layer_state = 0;
+    real_mods = weak_mods = oneshot_mods = 0;
+    clear_keys();
+    memset(&last_report, 0, sizeof(last_report));
+    memset(source_layers, 0, sizeof(source_layers));
+    memset(deferred, 0, sizeof(deferred));
+    memset(&leader, 0, sizeof(leader));
+    typo_buffer[0]   = KC_SPC;
+    typo_buffer_size = 1;
+    detected_os      = OS_UNSURE;
+    host_led_state   = (led_t){0};
+    rand16seed       = 1337;
+    rendered_mode    = RGB_MATRIX_NONE;
+    board_init();
+
+    // keyboard_init(): settings from EEPROM, then the user's post-init hook
+    if (!eeprom.valid) {
+        eeconfig_init();
+    }
+    keymap_config.nkro = false;
+    rgb                = eeprom.rgb;
+    default_layer_set(eeprom.default_layer);
+    keyboard_post_init_user();
+}
+
+void host_boot(void) {
+    memset(&eeprom, 0, sizeof(eeprom));
+    host_reboot();
+}
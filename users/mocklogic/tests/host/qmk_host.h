@@ -0,0 +1,579 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Host stand-in for the parts of QMK that the userspace uses, for the tests in
+// users/mocklogic/tests. It is passed as QMK_KEYBOARD_H, so mocklogic.c, the
+// feature sources and a board's keymap.c build unchanged. qmk_host.c models
+// the core around them: layers, the key pipeline (user hook, leader,
+// autocorrect, basic keycodes), HID reports, EEPROM, RGB matrix settings and
+// deferred execution, on a virtual clock. It also counts the calls the tests
+// put budgets on.
+//
+// Keycode values follow QMK where the userspace or the tests look at them
+// (HID usages, modifier bits, SAFE_RANGE); the rest only need to be distinct.
+// Feature switches (RGB_MATRIX_ENABLE, LEADER_ENABLE, ...) come from the
+// Makefile, as OPT_DEFS do in a firmware build.
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PROGMEM
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
+
+#ifndef MIN
+#    define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif
+#ifndef MAX
+#    define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#include "host_board.h"
+
+// -----------------------------------------------------------------------------
+// Keycodes
+// -----------------------------------------------------------------------------
+
+enum qk_keycodes {
+    KC_NO   = 0x0000,
+    KC_TRNS = 0x0001,
+
+    KC_A = 0x0004, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M,
+    KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T, KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z,
+    KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0,
+    KC_ENT, KC_ESC, KC_BSPC, KC_TAB, KC_SPC, KC_MINS, KC_EQL, KC_LBRC, KC_RBRC, KC_BSLS,
+    KC_NUHS, KC_SCLN, KC_QUOT, KC_GRV, KC_COMM, KC_DOT, KC_SLSH, KC_CAPS,
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10, KC_F11, KC_F12,
+    KC_PSCR, KC_SCRL, KC_PAUS, KC_INS, KC_HOME, KC_PGUP, KC_DEL, KC_END, KC_PGDN,
+    KC_RGHT, KC_LEFT, KC_DOWN, KC_UP, KC_NUM,
+    KC_PSLS, KC_PAST, KC_PMNS, KC_PPLS, KC_PENT,
+    KC_P1, KC_P2, KC_P3, KC_P4, KC_P5, KC_P6, KC_P7, KC_P8, KC_P9, KC_P0, KC_PDOT, KC_NUBS, KC_APP,
+    KC_INT1 = 0x0087, KC_INT2,
+
+    // System, consumer and mouse keys: not part of the keyboard report
+    KC_MUTE = 0x00A8, KC_VOLU, KC_VOLD, KC_MNXT, KC_MPRV, KC_MSTP, KC_MPLY,
+    KC_MYCM = 0x00B8,
+    KC_BRIU = 0x00BD, KC_BRID,
+    KC_MISSION_CONTROL = 0x00C1, KC_LAUNCHPAD,
+    MS_UP = 0x00CD, MS_DOWN, MS_LEFT, MS_RGHT, MS_BTN1, MS_BTN2,
+
+    KC_LCTL = 0x00E0, KC_LSFT, KC_LALT, KC_LGUI, KC_RCTL, KC_RSFT, KC_RALT, KC_RGUI,
+
+    QK_MODS      = 0x0100,
+    QK_MODS_MAX  = 0x1FFF,
+    QK_MOMENTARY = 0x5220,
+
+    NK_TOGG = 0x7013,
+    RM_ON   = 0x7840, RM_OFF, RM_TOGG, RM_NEXT, RM_PREV, RM_HUEU, RM_HUED, RM_SATU, RM_SATD, RM_VALU, RM_VALD,
+    QK_BOOT = 0x7C00,
+    QK_LEAD = 0x7C58,
+
+    SAFE_RANGE = 0x7E40,
+};
+
+#define _______ KC_TRNS
+#define XXXXXXX KC_NO
+#define KC_RIGHT KC_RGHT
+#define KC_LOPT KC_LALT
+#define KC_ROPT KC_RALT
+#define KC_LCMD KC_LGUI
+#define KC_RCMD KC_RGUI
+#define KC_LWIN KC_LGUI
+#define KC_RWIN KC_RGUI
+
+#define QK_LCTL 0x0100
+#define QK_LSFT 0x0200
+#define QK_LALT 0x0400
+#define QK_LGUI 0x0800
+
+#define C(kc) (QK_LCTL | (kc))
+#define S(kc) (QK_LSFT | (kc))
+#define A(kc) (QK_LALT | (kc))
+#define G(kc) (QK_LGUI | (kc))
+#define LCTL(kc) C(kc)
+#define LSFT(kc) S(kc)
+#define LALT(kc) A(kc)
+#define LGUI(kc) G(kc)
+#define LCMD(kc) G(kc)
+#define MO(layer) (QK_MOMENTARY | ((layer) & 0x1F))
+
+#define IS_BASIC_KEYCODE(code) ((code) >= KC_A && (code) <= KC_PPLS)
+#define IS_MODIFIER_KEYCODE(code) ((code) >= KC_LCTL && (code) <= KC_RGUI)
+#define IS_QK_MODS(code) ((code) >= QK_MODS && (code) <= QK_MODS_MAX)
+#define QK_MODS_GET_MODS(kc) (((kc) >> 8) & 0x1F)
+#define QK_MODS_GET_BASIC_KEYCODE(kc) ((kc) & 0xFF)
+
+// -----------------------------------------------------------------------------
+// Modifiers
+// -----------------------------------------------------------------------------
+
+#define MOD_BIT(code) (1 << ((code) & 0x07))
+
+#define MOD_LCTL 0x01
+#define MOD_LSFT 0x02
+#define MOD_LALT 0x04
+#define MOD_LGUI 0x08
+
+#define MOD_MASK_CTRL  (MOD_BIT(KC_LCTL) | MOD_BIT(KC_RCTL))
+#define MOD_MASK_SHIFT (MOD_BIT(KC_LSFT) | MOD_BIT(KC_RSFT))
+#define MOD_MASK_ALT   (MOD_BIT(KC_LALT) | MOD_BIT(KC_RALT))
+#define MOD_MASK_GUI   (MOD_BIT(KC_LGUI) | MOD_BIT(KC_RGUI))
+
+uint8_t get_mods(void);
+void    set_mods(uint8_t mods);
+void    add_mods(uint8_t mods);
+void    del_mods(uint8_t mods);
+void    clear_mods(void);
+uint8_t get_weak_mods(void);
+void    add_weak_mods(uint8_t mods);
+void    del_weak_mods(uint8_t mods);
+uint8_t get_oneshot_mods(void);
+void    clear_oneshot_mods(void);
+
+// -----------------------------------------------------------------------------
+// Keys and HID reports
+// -----------------------------------------------------------------------------
+
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef enum {
+    TICK_EVENT = 0,
+    KEY_EVENT  = 1,
+} keyevent_type_t;
+
+typedef struct {
+    keypos_t        key;
+    uint16_t        time;
+    keyevent_type_t type;
+    bool            pressed;
+} keyevent_t;
+
+typedef struct {
+    uint8_t count;
+    bool    interrupted;
+} tap_t;
+
+typedef struct {
+    keyevent_t event;
+    tap_t      tap;
+} keyrecord_t;
+
+#define IS_KEYEVENT(event) ((event).type == KEY_EVENT)
+#define KEYEQ(a, b) ((a).row == (b).row && (a).col == (b).col)
+
+void add_key(uint8_t key);
+void del_key(uint8_t key);
+void clear_keys(void);
+void send_keyboard_report(void);
+
+void register_code(uint8_t code);
+void unregister_code(uint8_t code);
+void tap_code(uint8_t code);
+void register_code16(uint16_t code);
+void unregister_code16(uint16_t code);
+void tap_code16(uint16_t code);
+
+void send_char(char ascii);
+void send_string(const char *string);
+#define SEND_STRING(string) send_string(string)
+
+const char *get_numeric_str(char *buf, size_t size, uint32_t value, char pad);
+const char *get_u8_str(uint8_t value, char pad);
+const char *get_u16_str(uint16_t value, char pad);
+
+typedef struct {
+    uint8_t buttons;
+    int8_t  x;
+    int8_t  y;
+    int8_t  v;
+    int8_t  h;
+} report_mouse_t;
+
+typedef union {
+    uint8_t raw;
+    struct {
+        bool    num_lock : 1;
+        bool    caps_lock : 1;
+        bool    scroll_lock : 1;
+        bool    compose : 1;
+        bool    kana : 1;
+        uint8_t reserved : 3;
+    };
+} led_t;
+
+led_t host_keyboard_led_state(void);
+
+typedef struct {
+    bool nkro;
+} keymap_config_t;
+
+extern keymap_config_t keymap_config;
+
+// -----------------------------------------------------------------------------
+// Timer (virtual, advanced by host_idle())
+// -----------------------------------------------------------------------------
+
+extern uint32_t host_now;
+
+static inline uint16_t timer_read(void) {
+    return (uint16_t)host_now;
+}
+static inline uint32_t timer_read32(void) {
+    return host_now;
+}
+static inline uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(host_now - last);
+}
+static inline uint32_t timer_elapsed32(uint32_t last) {
+    return host_now - last;
+}
+
+#define TIMER_DIFF_16(a, b) ((uint16_t)((a) - (b)))
+#define TIMER_DIFF_32(a, b) ((uint32_t)((a) - (b)))
+#define timer_expired32(current, future) ((uint32_t)((current) - (future)) < 0x80000000UL)
+
+void wait_ms(uint32_t ms);
+
+// -----------------------------------------------------------------------------
+// Layers and keymap
+// -----------------------------------------------------------------------------
+
+typedef uint32_t layer_state_t;
+
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+uint8_t get_highest_layer(layer_state_t state);
+bool    layer_state_is(uint8_t layer);
+bool    layer_state_cmp(layer_state_t state, uint8_t layer);
+void    layer_state_set(layer_state_t state);
+void    layer_clear(void);
+void    layer_move(uint8_t layer);
+void    layer_on(uint8_t layer);
+void    layer_off(uint8_t layer);
+void    layer_or(layer_state_t state);
+void    layer_and(layer_state_t state);
+void    default_layer_set(layer_state_t state);
+void    set_single_persistent_default_layer(uint8_t layer);
+
+extern const uint16_t keymaps[][MATRIX_ROWS][MATRIX_COLS];
+
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
+
+// -----------------------------------------------------------------------------
+// EEPROM
+// -----------------------------------------------------------------------------
+
+void     eeconfig_init(void);
+uint32_t eeconfig_read_user(void);
+void     eeconfig_update_user(uint32_t value);
+void     eeconfig_update_default_layer(layer_state_t state);
+bool     eeconfig_is_user_datablock_valid(void);
+void     eeconfig_init_user_datablock(void);
+uint32_t eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length);
+uint32_t eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length);
+
+void soft_reset_keyboard(void);
+
+// -----------------------------------------------------------------------------
+// Deferred execution
+// -----------------------------------------------------------------------------
+
+typedef uint8_t deferred_token;
+#define INVALID_DEFERRED_TOKEN 0
+
+typedef uint32_t (*deferred_exec_callback)(uint32_t trigger_time, void *cb_arg);
+
+deferred_token defer_exec(uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg);
+bool           extend_deferred_exec(deferred_token token, uint32_t delay_ms);
+bool           cancel_deferred_exec(deferred_token token);
+
+// -----------------------------------------------------------------------------
+// Leader, autocorrect, OS detection
+// -----------------------------------------------------------------------------
+
+bool leader_sequence_active(void);
+bool leader_sequence_one_key(uint16_t kc);
+bool leader_sequence_two_keys(uint16_t kc1, uint16_t kc2);
+bool leader_sequence_three_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3);
+bool leader_sequence_four_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4);
+bool leader_sequence_five_keys(uint16_t kc1, uint16_t kc2, uint16_t kc3, uint16_t kc4, uint16_t kc5);
+
+void autocorrect_enable(void);
+void autocorrect_disable(void);
+bool autocorrect_is_enabled(void);
+
+typedef enum {
+    OS_UNSURE,
+    OS_LINUX,
+    OS_WINDOWS,
+    OS_MACOS,
+    OS_IOS,
+} os_variant_t;
+
+os_variant_t detected_host_os(void);
+
+// -----------------------------------------------------------------------------
+// Color math (lib8tion subset)
+// -----------------------------------------------------------------------------
+
+typedef struct {
+    uint8_t r, g, b;
+} RGB;
+
+typedef struct {
+    uint8_t h, s, v;
+} HSV;
+
+static inline uint8_t scale8(uint8_t i, uint8_t scale) {
+    return ((uint16_t)i * (uint16_t)scale) >> 8;
+}
+static inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned t = i + j;
+    return t > 255 ? 255 : t;
+}
+static inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    return i > j ? i - j : 0;
+}
+
+void    random16_set_seed(uint16_t seed);
+uint8_t random8(void);
+
+// -----------------------------------------------------------------------------
+// RGB matrix
+// -----------------------------------------------------------------------------
+
+#define NO_LED 255
+
+#define LED_FLAG_NONE      0x00
+#define LED_FLAG_MODIFIER  0x01
+#define LED_FLAG_UNDERGLOW 0x02
+#define LED_FLAG_KEYLIGHT  0x04
+#define LED_FLAG_INDICATOR 0x08
+#define LED_FLAG_ALL       0xFF
+
+#define HAS_ANY_FLAGS(bits, flags) (((bits) & (flags)) != 0x00)
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+} led_point_t;
+
+typedef struct {
+    uint8_t     matrix_co[MATRIX_ROWS][MATRIX_COLS];
+    led_point_t point[RGB_MATRIX_LED_COUNT];
+    uint8_t     flags[RGB_MATRIX_LED_COUNT];
+} led_config_t;
+
+extern led_config_t g_led_config;
+
+typedef struct {
+    uint8_t iter;
+    uint8_t flags;
+    bool    init;
+} effect_params_t;
+
+// Whole frame in one pass (iter 0)
+#define RGB_MATRIX_USE_LIMITS(min, max) \
+    uint8_t min = 0;                    \
+    uint8_t max = RGB_MATRIX_LED_COUNT
+#define RGB_MATRIX_TEST_LED_FLAGS() \
+    if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
+
+static inline bool rgb_matrix_check_finished_leds(uint8_t led_max) {
+    return led_max < RGB_MATRIX_LED_COUNT;
+}
+
+// The effects config.h enables, in QMK's order (saved modes are indices)
+enum rgb_matrix_effects {
+    RGB_MATRIX_NONE = 0,
+    RGB_MATRIX_SOLID_COLOR,
+    RGB_MATRIX_CYCLE_PINWHEEL,
+    RGB_MATRIX_RAINDROPS,
+    RGB_MATRIX_MULTISPLASH,
+    RGB_MATRIX_STARLIGHT_DUAL_HUE,
+    RGB_MATRIX_RIVERFLOW,
+    RGB_MATRIX_CUSTOM_sparse_heatmap,
+    RGB_MATRIX_CUSTOM_column_rain,
+    RGB_MATRIX_EFFECT_MAX
+};
+
+#define RGB_MATRIX_HUE_STEP 8
+#define RGB_MATRIX_SAT_STEP 16
+#define RGB_MATRIX_VAL_STEP 16
+#define RGB_MATRIX_SPD_STEP 16
+#define RGB_MATRIX_MAXIMUM_BRIGHTNESS 255
+
+#define RGB_BLACK       0x00, 0x00, 0x00
+#define RGB_BLUE        0x00, 0x00, 0xFF
+#define RGB_CHARTREUSE  0x80, 0xFF, 0x00
+#define RGB_CYAN        0x00, 0xFF, 0xFF
+#define RGB_GOLD        0xFF, 0xD9, 0x00
+#define RGB_GREEN       0x00, 0xFF, 0x00
+#define RGB_MAGENTA     0xFF, 0x00, 0xFF
+#define RGB_ORANGE      0xFF, 0x80, 0x00
+#define RGB_PINK        0xFF, 0x80, 0xBF
+#define RGB_PURPLE      0x7A, 0x00, 0xFF
+#define RGB_RED         0xFF, 0x00, 0x00
+#define RGB_SPRINGGREEN 0x00, 0xFF, 0x80
+#define RGB_TEAL        0x00, 0x80, 0x80
+#define RGB_WHITE       0xFF, 0xFF, 0xFF
+#define RGB_YELLOW      0xFF, 0xFF, 0x00
+
+extern uint32_t g_rgb_timer;
+
+void    rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
+void    rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
+void    rgb_matrix_enable(void);
+void    rgb_matrix_enable_noeeprom(void);
+void    rgb_matrix_disable_noeeprom(void);
+bool    rgb_matrix_is_enabled(void);
+void    rgb_matrix_mode(uint8_t mode);
+void    rgb_matrix_mode_noeeprom(uint8_t mode);
+uint8_t rgb_matrix_get_mode(void);
+void    rgb_matrix_sethsv(uint8_t hue, uint8_t sat, uint8_t val);
+void    rgb_matrix_sethsv_noeeprom(uint8_t hue, uint8_t sat, uint8_t val);
+HSV     rgb_matrix_get_hsv(void);
+uint8_t rgb_matrix_get_val(void);
+void    rgb_matrix_set_speed(uint8_t speed);
+void    rgb_matrix_set_speed_noeeprom(uint8_t speed);
+uint8_t rgb_matrix_get_speed(void);
+
+// -----------------------------------------------------------------------------
+// Hooks the core calls (implemented by the userspace)
+// -----------------------------------------------------------------------------
+
+void          keyboard_post_init_user(void);
+void          eeconfig_init_user(void);
+void          housekeeping_task_user(void);
+bool          process_record_user(uint16_t keycode, keyrecord_t *record);
+layer_state_t layer_state_set_user(layer_state_t state);
+layer_state_t default_layer_state_set_user(layer_state_t state);
+void          leader_start_user(void);
+void          leader_end_user(void);
+bool          process_autocorrect_user(uint16_t *keycode, keyrecord_t *record, uint8_t *typo_buffer_size, uint8_t *mods);
+bool          apply_autocorrect(uint8_t backspaces, const char *str, char *typo, char *correct);
+bool          process_detected_host_os_user(os_variant_t detected_os);
+bool          led_update_user(led_t led_state);
+bool          rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
+void          suspend_power_down_user(void);
+
+// -----------------------------------------------------------------------------
+// Host side: driving the keyboard and inspecting what it did
+// -----------------------------------------------------------------------------
+
+// Keymap under test (host_keymap.c)
+uint8_t  host_keymap_layer_count(void);
+uint16_t host_keymap_read(uint8_t layer, uint8_t row, uint8_t col);
+
+// One keyboard report as the host computer saw it
+typedef struct {
+    uint8_t mods;
+    uint8_t keys[6];
+} host_report_t;
+
+#define HOST_REPORT_LOG_SIZE 1024
+#define HOST_TEXT_SIZE       2048
+
+// Calls the tests put budgets on. Userspace and core calls both count, except
+// keymap reads: the core's lookup of each pressed key is not counted, so
+// keymap_reads is what the userspace adds on top of it.
+typedef struct {
+    uint32_t keymap_reads;       // keymap_key_to_keycode()
+    uint32_t eeprom_writes;      // eeconfig_update_*() user, datablock, default layer
+    uint32_t hid_reports;        // Keyboard reports sent (unchanged reports are dropped, as in QMK)
+    uint32_t rgb_mode;           // rgb_matrix_mode()
+    uint32_t rgb_mode_noeeprom;  // rgb_matrix_mode_noeeprom()
+    uint32_t soft_resets;        // soft_reset_keyboard()
+} host_counts_t;
+
+extern host_counts_t host_counts;
+
+// Host time spent in the userspace hooks the key pipeline calls. Host time is
+// not MCU time: use it to compare two versions of a hook on the same trace.
+typedef enum {
+    HOST_HOOK_PROCESS_RECORD_USER,
+    HOST_HOOK_LAYER_STATE_SET_USER,
+    HOST_HOOK_LEADER_END_USER,
+    HOST_HOOK_COUNT
+} host_hook_t;
+
+typedef struct {
+    uint32_t count;
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint64_t total_ns;
+} host_hook_time_t;
+
+extern host_hook_time_t  host_hook_times[HOST_HOOK_COUNT];
+extern const char *const host_hook_names[HOST_HOOK_COUNT];
+
+extern host_report_t host_reports[HOST_REPORT_LOG_SIZE];
+extern uint16_t      host_report_count;
+
+// A report as "mods+keys" ("CS+RGHT": C, S, A and G, lower case for the right
+// hand; "-" is the empty report). Returns the length, like snprintf().
+int host_format_report(const host_report_t *report, char *buf, size_t size);
+
+// Text the host computer would show: reports decoded through a US layout,
+// with Backspace deleting the last character
+extern char host_text[HOST_TEXT_SIZE];
+
+// LED colors of the last host_render_indicators() or host_render_frame()
+extern RGB host_leds[RGB_MATRIX_LED_COUNT];
+
+// Wipe EEPROM and all host state, then boot: eeconfig init, default layer,
+// keyboard_post_init_user(). Userspace statics are re-initialized by the boot.
+void host_boot(void);
+
+// Boot again on the current EEPROM contents (a power cycle)
+void host_reboot(void);
+
+// Forget logged reports, text, counts and hook times
+void host_clear_log(void);
+
+// Run the main loop for ms milliseconds: deferred executors, leader timeout
+// and housekeeping_task_user() once per millisecond
+void host_idle(uint32_t ms);
+
+// One matrix event through the key pipeline at the current time
+void host_key_event(uint8_t row, uint8_t col, bool pressed);
+
+// Keycode a press of the key would send now, through the active layers
+uint16_t host_keycode_at(uint8_t row, uint8_t col);
+
+// Matrix position of the first key with keycode on the given layer
+bool host_find_key(uint8_t layer, uint16_t keycode, keypos_t *pos);
+
+// Press and release the key that types keycode on layer, holding it hold_ms
+// and idling gap_ms after the release
+void host_tap_key(uint8_t layer, uint16_t keycode, uint32_t hold_ms, uint32_t gap_ms);
+
+// Taps of the base-layer keys for a lowercase string (a-z, 0-9, space)
+void host_type(const char *text);
+
+// OS detection reports a host
+void host_detect_os(os_variant_t os);
+
+// Draw one frame of the userspace indicators over a black background
+void host_render_indicators(void);
+
+// Draw one frame as rgb_matrix_task() does: the effect, then the indicators.
+// SOLID_COLOR and the userspace effects are drawn; QMK's animations and a
+// disabled matrix leave the LEDs black.
+void host_render_frame(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,100 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Shared fixture for the host tests: boots the keyboard from a blank EEPROM
+// and drives it with key taps or replayed traces, returning the HID reports
+// as readable strings.
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+extern "C" {
+#include QMK_KEYBOARD_H
+#include "mocklogic.h"
+#include "autocorrect_stats.h"
+#include "color_math.h"
+#include "host_profile.h"
+#include "rgb_presets.h"
+#include "select_word.h"
+#include "whack_a_mole.h"
+}
+
+class HostTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        host_boot();
+        host_idle(100);
+        host_clear_log();
+    }
+
+    static uint8_t base_layer(void) {
+        return get_highest_layer(default_layer_state);
+    }
+
+    // Position of keycode on layer, failing the test if it is not mapped
+    static keypos_t find(uint8_t layer, uint16_t keycode) {
+        keypos_t pos = {0, 0};
+        EXPECT_TRUE(host_find_key(layer, keycode, &pos)) << "keycode 0x" << std::hex << keycode << " not on layer " << std::dec << (int)layer;
+        return pos;
+    }
+
+    static void press(uint8_t layer, uint16_t keycode) {
+        keypos_t pos = find(layer, keycode);
+        host_key_event(pos.row, pos.col, true);
+    }
+
+    static void release(uint8_t layer, uint16_t keycode) {
+        keypos_t pos = find(layer, keycode);
+        host_key_event(pos.row, pos.col, false);
+    }
+
+    static void tap(uint8_t layer, uint16_t keycode) {
+        host_tap_key(layer, keycode, 30, 70);
+    }
+
+    // Taps a key of the _FEATURES layer with the FN key held
+    static void fn_tap(uint16_t keycode) {
+        press(base_layer(), FN_WIN);
+        host_idle(30);
+        tap(_FEATURES, keycode);
+        release(base_layer(), FN_WIN);
+        host_idle(70);
+    }
+
+    // Types a leader sequence and waits for it to time out
+    static void leader(const char *sequence) {
+        fn_tap(QK_LEAD);
+        host_type(sequence);
+        host_idle(LEADER_TIMEOUT + 10);
+    }
+
+    // Replays a table from tools/trace_decode.py --c on the virtual clock
+    template <typename event_t, size_t count>
+    static void replay(const event_t (&events)[count]) {
+        for (const event_t &e : events) {
+            host_idle(e.delta_ms);
+            host_key_event(e.row, e.col, e.pressed);
+        }
+    }
+
+    // The logged HID reports, see host_format_report()
+    static std::string reports(void) {
+        std::string log;
+        for (uint16_t i = 0; i < host_report_count; i++) {
+            if (i > 0) {
+                log += ' ';
+            }
+            log += describe(host_reports[i]);
+        }
+        return log;
+    }
+
+    static std::string describe(const host_report_t &report) {
+        char word[64];
+        host_format_report(&report, word, sizeof(word));
+        return word;
+    }
+};
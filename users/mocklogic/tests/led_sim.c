@@ -0,0 +1,378 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// LED simulator driver (README.md, "LED Simulator"), built and run by
+// tools/led_sim.py against a board generated from a QMK checkout.
+//
+// The keyboard boots on the host stand-in, selects a background effect and
+// brings up a layer the way a user would (FN held, or a leader sequence).
+// Frames are then drawn with host_render_frame() - the effect, then the
+// userspace indicators, per-layer ones included - on the virtual clock, with
+// synthetic typing through the key pipeline in between.
+
+#include QMK_KEYBOARD_H
+#include "mocklogic.h"
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// -----------------------------------------------------------------------------
+// Options
+// -----------------------------------------------------------------------------
+
+static const struct {
+    const char *name;
+    uint8_t     mode;
+} effects[] = {
+    {"heatmap", RGB_MATRIX_CUSTOM_sparse_heatmap},
+    {"rain", RGB_MATRIX_CUSTOM_column_rain},
+    {"solid", RGB_MATRIX_SOLID_COLOR},
+};
+
+// How each layer is reached: FN held, or a leader sequence
+static const struct {
+    const char *name;
+    uint8_t     layer;
+    const char *sequence;
+} layers[] = {
+    {"base", 0, NULL},
+    {"features", _FEATURES, NULL},
+    {"gaming", _GAMING, "game"},
+    {"mouse", _MOUSE, "mouse"},
+    {"kiddo", _KIDDO, "kiddo"},
+    {"rgb", _RGB_CFG, "rgb"},
+};
+
+static struct {
+    uint8_t     effect;
+    uint8_t     layer;
+    uint32_t    frames;
+    uint16_t    frame_ms;  // Virtual time per frame
+    uint16_t    speedup;   // Real time per frame is frame_ms / speedup (0 = no waiting)
+    uint8_t     cps;       // Synthetic key presses per virtual second
+    uint8_t     hit_pct;   // Kiddo layer: chance a press lands on a mole
+    uint8_t     hue;
+    uint8_t     speed;
+    uint32_t    seed;
+    const char *ppm;    // Write frames here instead of the terminal
+    uint8_t     scale;  // PPM pixels per LED unit
+} opt = {0, 0, 200, 16, 1, 8, 40, 0, 128, 1, NULL, 2};
+
+static void usage(const char *argv0) {
+    fprintf(stderr,
+            "usage: %s [--effect heatmap|rain|solid] [--layer base|features|gaming|mouse|kiddo|rgb]\n"
+            "          [--frames N] [--frame-ms MS] [--speedup X] [--cps N] [--hit-pct N]\n"
+            "          [--hue H] [--speed S] [--seed N] [--ppm FILE] [--scale N]\n",
+            argv0);
+    exit(2);
+}
+
+static void parse_args(int argc, char **argv) {
+    static const struct option longopts[] = {
+        {"effect", required_argument, NULL, 'e'},   {"layer", required_argument, NULL, 'l'},
+        {"frames", required_argument, NULL, 'n'},   {"frame-ms", required_argument, NULL, 'f'},
+        {"speedup", required_argument, NULL, 'x'},  {"cps", required_argument, NULL, 'c'},
+        {"hit-pct", required_argument, NULL, 'p'},  {"hue", required_argument, NULL, 'h'},
+        {"speed", required_argument, NULL, 's'},    {"seed", required_argument, NULL, 'r'},
+        {"ppm", required_argument, NULL, 'o'},      {"scale", required_argument, NULL, 'k'},
+        {NULL, 0, NULL, 0},
+    };
+    int  c;
+    bool found;
+    while ((c = getopt_long(argc, argv, "", longopts, NULL)) != -1) {
+        switch (c) {
+            case 'e':
+                found = false;
+                for (uint8_t i = 0; i < ARRAY_SIZE(effects); i++) {
+                    if (!strcmp(optarg, effects[i].name)) {
+                        opt.effect = i;
+                        found      = true;
+                    }
+                }
+                if (!found) {
+                    usage(argv[0]);
+                }
+                break;
+            case 'l':
+                found = false;
+                for (uint8_t i = 0; i < ARRAY_SIZE(layers); i++) {
+                    if (!strcmp(optarg, layers[i].name)) {
+                        opt.layer = i;
+                        found     = true;
+                    }
+                }
+                if (!found) {
+                    usage(argv[0]);
+                }
+                break;
+            case 'n': opt.frames = strtoul(optarg, NULL, 0); break;
+            case 'f': opt.frame_ms = strtoul(optarg, NULL, 0); break;
+            case 'x': opt.speedup = strtoul(optarg, NULL, 0); break;
+            case 'c': opt.cps = strtoul(optarg, NULL, 0); break;
+            case 'p': opt.hit_pct = strtoul(optarg, NULL, 0); break;
+            case 'h': opt.hue = strtoul(optarg, NULL, 0); break;
+            case 's': opt.speed = strtoul(optarg, NULL, 0); break;
+            case 'r': opt.seed = strtoul(optarg, NULL, 0); break;
+            case 'o': opt.ppm = optarg; break;
+            case 'k': opt.scale = strtoul(optarg, NULL, 0); break;
+            default: usage(argv[0]);
+        }
+    }
+    if (opt.frame_ms == 0 || opt.scale == 0) {
+        usage(argv[0]);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Driving the keyboard
+// -----------------------------------------------------------------------------
+
+// The driver's own random numbers (xorshift32), apart from the keyboard's
+static uint32_t rng_state = 1;
+
+static uint32_t sim_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void tap(uint8_t layer, uint16_t keycode) {
+    keypos_t pos;
+    if (!host_find_key(layer, keycode, &pos)) {
+        fprintf(stderr, "keycode 0x%04x not on layer %u\n", keycode, layer);
+        exit(1);
+    }
+    host_tap_key(layer, keycode, 30, 70);
+}
+
+static void enter_layer(void) {
+    uint8_t  base = get_highest_layer(default_layer_state);
+    keypos_t fn;
+    if (!host_find_key(base, FN_WIN, &fn)) {
+        fprintf(stderr, "no FN key on the base layer\n");
+        exit(1);
+    }
+
+    const char *sequence = layers[opt.layer].sequence;
+    if (layers[opt.layer].layer == _FEATURES) {
+        host_key_event(fn.row, fn.col, true);  // Held for the whole run
+        host_idle(30);
+    } else if (sequence) {
+        host_key_event(fn.row, fn.col, true);
+        host_idle(30);
+        tap(_FEATURES, QK_LEAD);
+        host_key_event(fn.row, fn.col, false);
+        host_idle(70);
+        host_type(sequence);
+        host_idle(LEADER_TIMEOUT + 10);
+    }
+    if (layers[opt.layer].layer && !layer_state_is(layers[opt.layer].layer)) {
+        fprintf(stderr, "layer %s did not come up\n", layers[opt.layer].name);
+        exit(1);
+    }
+}
+
+// Keys for synthetic typing: lit keys that type a character on the base
+// layer and, on the active layers, still do (or are blocked). Layer keys,
+// ESC (it leaves layers) and the keyboard's own functions are left alone.
+static keypos_t typing_keys[MATRIX_ROWS * MATRIX_COLS];
+static uint16_t typing_key_count;
+
+static bool is_typing_keycode(uint16_t keycode) {
+    return keycode >= KC_A && keycode <= KC_SLSH && keycode != KC_ESC;
+}
+
+static void collect_typing_keys(void) {
+    uint8_t base = get_highest_layer(default_layer_state);
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            uint16_t keycode = host_keycode_at(row, col);
+            if (g_led_config.matrix_co[row][col] != NO_LED && is_typing_keycode(host_keymap_read(base, row, col)) &&
+                (keycode == KC_NO || is_typing_keycode(keycode))) {
+                typing_keys[typing_key_count++] = (keypos_t){col, row};
+            }
+        }
+    }
+}
+
+// A typing key lit in the last frame: a mole on the Kiddo layer
+static bool find_lit_key(keypos_t *key) {
+    for (uint16_t i = 0; i < typing_key_count; i++) {
+        RGB c = host_leds[g_led_config.matrix_co[typing_keys[i].row][typing_keys[i].col]];
+        if (c.r | c.g | c.b) {
+            *key = typing_keys[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// One synthetic key at a time, held for KEY_HOLD_MS
+#define KEY_HOLD_MS 30
+
+static keypos_t held_key;
+static uint32_t held_since;
+static bool     holding;
+
+static void press_key(void) {
+    if (holding || typing_key_count == 0) {
+        return;
+    }
+    held_key = typing_keys[sim_random() % typing_key_count];
+    if (layers[opt.layer].layer == _KIDDO && sim_random() % 100 < opt.hit_pct) {
+        find_lit_key(&held_key);
+    }
+    host_key_event(held_key.row, held_key.col, true);
+    held_since = timer_read32();
+    holding    = true;
+}
+
+static void release_key(void) {
+    if (holding && timer_elapsed32(held_since) >= KEY_HOLD_MS) {
+        host_key_event(held_key.row, held_key.col, false);
+        holding = false;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Output
+// -----------------------------------------------------------------------------
+
+// Terminal grid: two characters per cell, one line per key row (the board
+// is 224 x 64 LED units, keys about 15 x 13 apart)
+#define TERM_COLS 60
+#define TERM_ROWS 6
+
+static void term_frame(bool first) {
+    static char cells[TERM_ROWS][TERM_COLS];
+    static RGB  colors[TERM_ROWS][TERM_COLS];
+    memset(cells, 0, sizeof(cells));
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        uint8_t x = (g_led_config.point[i].x * (TERM_COLS - 1) + 112) / 224;
+        uint8_t y = (g_led_config.point[i].y * (TERM_ROWS - 1) + 32) / 64;
+        RGB     c = host_leds[i];
+        // Keep the brightest LED where two share a cell
+        if (!cells[y][x] || c.r + c.g + c.b > colors[y][x].r + colors[y][x].g + colors[y][x].b) {
+            cells[y][x]  = 1;
+            colors[y][x] = c;
+        }
+    }
+
+    if (!first) {
+        printf("\x1b[%dA", TERM_ROWS);
+    }
+    for (uint8_t y = 0; y < TERM_ROWS; y++) {
+        for (uint8_t x = 0; x < TERM_COLS; x++) {
+            RGB c = colors[y][x];
+            if (!cells[y][x]) {
+                fputs("  ", stdout);
+            } else if (!(c.r | c.g | c.b)) {
+                fputs("\x1b[38;2;60;60;60m\xc2\xb7\xc2\xb7\x1b[0m", stdout);  // Unlit LED
+            } else {
+                printf("\x1b[38;2;%d;%d;%dm\xe2\x96\x88\xe2\x96\x88\x1b[0m", c.r, c.g, c.b);
+            }
+        }
+        putchar('\n');
+    }
+    fflush(stdout);
+}
+
+// One binary PPM (P6) per frame, concatenated: a square of 3 x 3 LED units
+// per LED, scaled by opt.scale
+static void ppm_frame(FILE *out) {
+    uint16_t width = 228 * opt.scale, height = 68 * opt.scale;
+    uint8_t *image = calloc((size_t)width * height, 3);
+    uint16_t size  = 3 * opt.scale;
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        uint16_t x0 = g_led_config.point[i].x * opt.scale;
+        uint16_t y0 = g_led_config.point[i].y * opt.scale;
+        RGB      c  = host_leds[i];
+        if (!(c.r | c.g | c.b)) {
+            c = (RGB){24, 24, 24};
+        }
+        for (uint16_t y = y0; y < y0 + size && y < height; y++) {
+            for (uint16_t x = x0; x < x0 + size && x < width; x++) {
+                uint8_t *p = image + ((size_t)y * width + x) * 3;
+                p[0] = c.r, p[1] = c.g, p[2] = c.b;
+            }
+        }
+    }
+    fprintf(out, "P6\n%d %d\n255\n", width, height);
+    fwrite(image, 3, (size_t)width * height, out);
+    free(image);
+}
+
+// -----------------------------------------------------------------------------
+// Frame loop
+// -----------------------------------------------------------------------------
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+    parse_args(argc, argv);
+
+    FILE *ppm = NULL;
+    if (opt.ppm) {
+        ppm = strcmp(opt.ppm, "-") ? fopen(opt.ppm, "wb") : stdout;
+        if (!ppm) {
+            perror(opt.ppm);
+            return 1;
+        }
+    }
+
+    host_boot();
+    random16_set_seed(opt.seed);
+    rng_state = opt.seed | 1;
+    rgb_matrix_mode_noeeprom(effects[opt.effect].mode);
+    rgb_matrix_sethsv_noeeprom(opt.hue, 255, 255);
+    rgb_matrix_set_speed_noeeprom(opt.speed);
+    enter_layer();
+    collect_typing_keys();
+
+    uint64_t total_ns = 0, min_ns = UINT64_MAX, max_ns = 0;
+    uint32_t press_acc = 0;  // Key presses owed, in 1/1000
+    for (uint32_t frame = 0; frame < opt.frames; frame++) {
+        uint64_t start = now_ns();
+        host_render_frame();
+        uint64_t spent = now_ns() - start;
+        total_ns += spent;
+        min_ns = spent < min_ns ? spent : min_ns;
+        max_ns = spent > max_ns ? spent : max_ns;
+
+        if (ppm) {
+            ppm_frame(ppm);
+        } else {
+            term_frame(frame == 0);
+        }
+
+        // Advance the virtual clock, typing on the way (presses due while
+        // a key is still held are dropped)
+        host_idle(opt.frame_ms);
+        release_key();
+        for (press_acc += opt.cps * opt.frame_ms; press_acc >= 1000; press_acc -= 1000) {
+            press_key();
+        }
+        if (!ppm && opt.speedup) {
+            struct timespec wait = {0, (long)opt.frame_ms * 1000000 / opt.speedup};
+            nanosleep(&wait, NULL);
+        }
+    }
+
+    if (ppm && ppm != stdout) {
+        fclose(ppm);
+    }
+    if (opt.frames) {
+        fprintf(stderr, "%u frames, %u LEDs, %u ms virtual: compute avg %.2f us, min %.2f us, max %.2f us per frame\n",
+                opt.frames, RGB_MATRIX_LED_COUNT, opt.frames * opt.frame_ms, total_ns / 1000.0 / opt.frames,
+                min_ns / 1000.0, max_ns / 1000.0);
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Replay driver for a typed key event trace (README.md, "Key Event Traces"):
+//
+//   make -C users/mocklogic/tests replay TRACE=trace.txt [EXPECT=reports.txt]
+//
+// The Makefile decodes the trace with tools/trace_decode.py --c into
+// trace_events.h. The events then go through the key pipeline of a freshly
+// booted keyboard on the virtual clock, and the driver prints the HID
+// reports, the typed text, the layers left on and the host time spent in
+// process_record_user(), layer_state_set_user() and leader_end_user().
+//
+// With an expected reports file (report words as printed, any whitespace in
+// between), the replay fails if the keyboard sent anything else.
+
+#include QMK_KEYBOARD_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "trace_events.h"
+
+// Time for the timers still running after the last event (leader timeout,
+// select word repeat, layer exit tap term)
+#define REPLAY_SETTLE_MS 1000
+
+static bool check_reports(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        return false;
+    }
+
+    char     expected[64];
+    char     actual[64];
+    uint16_t i  = 0;
+    bool     ok = true;
+    while (fscanf(file, "%63s", expected) == 1) {
+        if (i >= host_report_count) {
+            printf("expected %s at report %u, got nothing\n", expected, i);
+            ok = false;
+            break;
+        }
+        host_format_report(&host_reports[i], actual, sizeof(actual));
+        if (strcmp(expected, actual) != 0) {
+            printf("expected %s at report %u, got %s\n", expected, i, actual);
+            ok = false;
+            break;
+        }
+        i++;
+    }
+    if (ok && i < host_report_count) {
+        printf("%u more reports than expected\n", host_report_count - i);
+        ok = false;
+    }
+    fclose(file);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    host_boot();
+    host_clear_log();
+
+    uint32_t duration = 0;
+    for (size_t i = 0; i < ARRAY_SIZE(trace_events); i++) {
+        host_idle(trace_events[i].delta_ms);
+        host_key_event(trace_events[i].row, trace_events[i].col, trace_events[i].pressed);
+        duration += trace_events[i].delta_ms;
+    }
+    host_idle(REPLAY_SETTLE_MS);
+
+    printf("events %u, %lu ms\n", (unsigned)ARRAY_SIZE(trace_events), (unsigned long)duration);
+
+    printf("reports");
+    for (uint16_t i = 0; i < host_report_count; i++) {
+        char word[64];
+        host_format_report(&host_reports[i], word, sizeof(word));
+        printf(" %s", word);
+    }
+    printf("\ntext \"%s\"\nlayers 0x%08lx default 0x%08lx\n", host_text, (unsigned long)layer_state, (unsigned long)default_layer_state);
+
+    printf("%-22s %6s %9s %9s %9s\n", "hook", "n", "min us", "avg us", "max us");
+    for (uint8_t hook = 0; hook < HOST_HOOK_COUNT; hook++) {
+        const host_hook_time_t *t = &host_hook_times[hook];
+        if (t->count == 0) {
+            continue;
+        }
+        printf("%-22s %6lu %9.2f %9.2f %9.2f\n", host_hook_names[hook], (unsigned long)t->count, t->min_ns / 1000.0, t->total_ns / 1000.0 / t->count, t->max_ns / 1000.0);
+    }
+
+    if (argc > 1 && !check_reports(argv[1])) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
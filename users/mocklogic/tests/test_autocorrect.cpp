@@ -0,0 +1,73 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Autocorrect (autocorrect_data.h) with the userspace hooks: what gets fixed,
+// what is left alone, and the hit counters of features/autocorrect_stats.c.
+
+#include "host_test.h"
+
+TEST_F(HostTest, AutocorrectFixesTypos) {
+    host_type(" teh abotu ");
+    EXPECT_STREQ(host_text, " the about ");
+}
+
+TEST_F(HostTest, AutocorrectLeavesWordsAlone) {
+    host_type(" the tehran about ");
+    EXPECT_STREQ(host_text, " the tehran about ");
+}
+
+TEST_F(HostTest, AutocorrectNeedsWordBoundary) {
+    // ":teh:" only matches a whole word
+    host_type(" xteh ");
+    EXPECT_STREQ(host_text, " xteh ");
+}
+
+TEST_F(HostTest, AutocorrectToggleKey) {
+    fn_tap(TOGGLE_AUTOCORRECT);
+    EXPECT_FALSE(userspace_config.autocorrect_enabled);
+    host_type(" teh ");
+    EXPECT_STREQ(host_text, " teh ");
+
+    host_clear_log();
+    fn_tap(TOGGLE_AUTOCORRECT);
+    host_type(" teh ");
+    EXPECT_STREQ(host_text, " the ");
+}
+
+TEST_F(HostTest, AutocorrectOffOnGamingLayer) {
+    leader("game");
+    ASSERT_TRUE(layer_state_is(_GAMING));
+    host_clear_log();
+    host_type(" teh ");
+    EXPECT_STREQ(host_text, " teh ");
+}
+
+TEST_F(HostTest, AutocorrectStatsCountHits) {
+    host_type(" teh teh abotu ");
+    host_clear_log();
+    leader("typo");
+    EXPECT_STREQ(host_text, "teh    2\nabotu    1\n");
+}
+
+TEST_F(HostTest, AutocorrectStatsFlushOncePerInterval) {
+    host_type(" teh ");
+    host_idle(AUTOCORRECT_STATS_FLUSH_INTERVAL - 1000);
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+
+    // More hits in the same window share the one write
+    host_type(" teh abotu ");
+    host_idle(1000);
+    EXPECT_EQ(host_counts.eeprom_writes, 1u);
+
+    // (Key usage has its own, longer flush interval)
+    host_idle(AUTOCORRECT_STATS_FLUSH_INTERVAL / 2);
+    EXPECT_EQ(host_counts.eeprom_writes, 1u) << "nothing new to save";
+}
+
+TEST_F(HostTest, AutocorrectStatsSurviveReboot) {
+    host_type(" teh ");
+    host_idle(AUTOCORRECT_STATS_FLUSH_INTERVAL);
+    host_reboot();
+    leader("typo");
+    EXPECT_STREQ(host_text, "teh    1\n");
+}
@@ -0,0 +1,106 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Call budgets: upper bounds on the keymap reads, EEPROM writes and HID
+// reports of the hot paths. A change that goes over a budget fails the test
+// run (and so the make) - raise the budget here only on purpose.
+//
+// Keymap reads are the userspace's own keymap_key_to_keycode() calls; the
+// core's lookup of the pressed key is not counted. Without the generated LED
+// map (tools/gen_led_map.py, firmware builds only) an indicator is one
+// keymap search per frame, so the frame budgets are in searches.
+
+#include "host_test.h"
+
+#define KEYMAP_SEARCH (MATRIX_ROWS * MATRIX_COLS)
+
+// Typing on the base layer: no keymap reads, one report down and one up
+#define BUDGET_TYPING_KEYMAP_READS     0
+#define BUDGET_TYPING_HID_REPORTS      2  // Per key
+#define BUDGET_TYPING_EEPROM_WRITES    0  // Within the flush intervals
+
+// An hour of typing: autocorrect stats every 15 minutes, key usage every 30
+// minutes with one write per matrix row
+#define BUDGET_HOUR_EEPROM_WRITES (4 + 2 * MATRIX_ROWS)
+
+// Select word: three taps of two reports plus restoring the mods
+#define BUDGET_SELECT_WORD_HID_REPORTS 7
+
+// A preset key: one effect mode change and one config save
+#define BUDGET_PRESET_RGB_MODE       1
+#define BUDGET_PRESET_EEPROM_WRITES  1
+
+// Indicator frames
+#define BUDGET_BASE_FRAME_KEYMAP_READS     0
+#define BUDGET_FEATURES_FRAME_KEYMAP_READS (15 * KEYMAP_SEARCH)
+#define BUDGET_KIDDO_FRAME_KEYMAP_READS    (1 * KEYMAP_SEARCH)
+
+// Whack-a-mole: a key press and its release look up the base keycode once
+// each; a new mole searches both base layers, up to 4 attempts
+#define BUDGET_KIDDO_TAP_KEYMAP_READS   2
+#define BUDGET_MOLE_PICK_KEYMAP_READS   (4 * 2 * KEYMAP_SEARCH)
+
+TEST_F(HostTest, BudgetTyping) {
+    const char text[] = " the quick brown fox jumps over the lazy dog ";
+    host_type(text);
+    ASSERT_STREQ(host_text, text);
+    EXPECT_LE(host_counts.keymap_reads, BUDGET_TYPING_KEYMAP_READS);
+    EXPECT_LE(host_counts.hid_reports, BUDGET_TYPING_HID_REPORTS * strlen(text));
+    EXPECT_LE(host_counts.eeprom_writes, BUDGET_TYPING_EEPROM_WRITES);
+}
+
+TEST_F(HostTest, BudgetHourOfTypingEepromWrites) {
+    for (uint8_t minute = 0; minute < 60; minute++) {
+        uint32_t start = timer_read32();
+        host_type(" teh quick brown fox ");
+        host_idle(60000 - timer_elapsed32(start));
+    }
+    EXPECT_GT(host_counts.eeprom_writes, 0u) << "the stats are saved at some point";
+    EXPECT_LE(host_counts.eeprom_writes, BUDGET_HOUR_EEPROM_WRITES);
+}
+
+TEST_F(HostTest, BudgetSelectWord) {
+    tap(base_layer(), SELWORD);
+    EXPECT_LE(host_counts.hid_reports, BUDGET_SELECT_WORD_HID_REPORTS);
+    EXPECT_EQ(host_counts.keymap_reads, 0u);
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+}
+
+TEST_F(HostTest, BudgetPresetKey) {
+    fn_tap(RGB_PRESET_4);
+    EXPECT_LE(host_counts.rgb_mode, BUDGET_PRESET_RGB_MODE);
+    EXPECT_LE(host_counts.eeprom_writes, BUDGET_PRESET_EEPROM_WRITES);
+}
+
+TEST_F(HostTest, BudgetIndicatorFrames) {
+    host_render_indicators();
+    EXPECT_LE(host_counts.keymap_reads, BUDGET_BASE_FRAME_KEYMAP_READS);
+
+    press(base_layer(), FN_WIN);
+    host_clear_log();
+    host_render_indicators();
+    EXPECT_LE(host_counts.keymap_reads, BUDGET_FEATURES_FRAME_KEYMAP_READS);
+    release(base_layer(), FN_WIN);
+
+    leader("kiddo");
+    host_clear_log();
+    host_render_indicators();
+    EXPECT_LE(host_counts.keymap_reads, BUDGET_KIDDO_FRAME_KEYMAP_READS);
+}
+
+TEST_F(HostTest, BudgetWhackAMole) {
+    leader("kiddo");
+
+    // Not a game key: only the base keycode lookup
+    host_clear_log();
+    tap(base_layer(), KC_F1);
+    EXPECT_LE(host_counts.keymap_reads, BUDGET_KIDDO_TAP_KEYMAP_READS);
+    EXPECT_EQ(host_report_count, 0u) << reports();
+
+    // Level 0 moles stay 1 to 2 seconds, so 10 s picks at most 10 new ones
+    host_clear_log();
+    host_idle(10000);
+    EXPECT_GT(host_counts.keymap_reads, 0u);
+    EXPECT_LE(host_counts.keymap_reads, 10 * BUDGET_MOLE_PICK_KEYMAP_READS);
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+}
@@ -0,0 +1,117 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Leader sequences (leader_end_user() in mocklogic.c): each sequence reaches
+// its action, and nothing of the sequence itself is typed.
+
+#include "host_test.h"
+
+TEST_F(HostTest, LeaderLayerShowsWhileTyping) {
+    fn_tap(QK_LEAD);
+    EXPECT_TRUE(layer_state_is(_LEADER));
+    host_type("ga");
+    EXPECT_TRUE(layer_state_is(_LEADER));
+    host_idle(LEADER_TIMEOUT + 10);
+    EXPECT_FALSE(layer_state_is(_LEADER));
+    EXPECT_EQ(host_report_count, 0u) << reports();
+}
+
+TEST_F(HostTest, LeaderLayers) {
+    const struct {
+        const char *sequence;
+        uint8_t     layer;
+    } sequences[] = {
+        {"game", _GAMING},
+        {"mouse", _MOUSE},
+        {"kiddo", _KIDDO},
+        {"rgb", _RGB_CFG},
+    };
+
+    for (const auto &s : sequences) {
+        host_boot();
+        host_idle(100);
+        leader(s.sequence);
+        EXPECT_EQ(layer_state, (layer_state_t)1 << s.layer) << s.sequence;
+        EXPECT_EQ(host_report_count, 0u) << s.sequence << ": " << reports();
+        EXPECT_STREQ(host_text, "") << s.sequence;
+    }
+}
+
+TEST_F(HostTest, LeaderKiddoBlanksBackground) {
+    leader("kiddo");
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_SOLID_COLOR);
+    EXPECT_EQ(rgb_matrix_get_val(), 0);
+    EXPECT_EQ(host_counts.rgb_mode, 0u) << "the background is not saved";
+}
+
+TEST_F(HostTest, LeaderTapsMissingKeys) {
+    const struct {
+        const char *sequence;
+        const char *reports;
+    } sequences[] = {
+        {"end", "END -"},
+        {"ins", "INS -"},
+        {"print", "PSCR -"},
+    };
+
+    for (const auto &s : sequences) {
+        host_clear_log();
+        leader(s.sequence);
+        EXPECT_EQ(reports(), s.reports) << s.sequence;
+        EXPECT_EQ(layer_state, 0u) << s.sequence;
+    }
+}
+
+TEST_F(HostTest, LeaderDumps) {
+    const struct {
+        const char *sequence;
+        const char *prefix;
+    } sequences[] = {
+        {"wpm", "wpm"},
+        {"keys", ""},
+        {"perf", "perf"},
+        {"trace", "trace 1 "},
+        {"mole", "    0\n    0\n    0\n"},
+    };
+
+    for (const auto &s : sequences) {
+        host_clear_log();
+        leader(s.sequence);
+        EXPECT_EQ(std::string(host_text).rfind(s.prefix, 0), 0u) << s.sequence << ": " << host_text;
+        EXPECT_EQ(host_counts.eeprom_writes, 0u) << s.sequence;
+    }
+}
+
+TEST_F(HostTest, LeaderHostOverride) {
+    const struct {
+        const char      *sequence;
+        host_override_t  override;
+        host_profile_t   profile;
+    } sequences[] = {
+        {"mac", HOST_OVERRIDE_MAC, HOST_PROFILE_MAC},
+        {"win", HOST_OVERRIDE_WIN, HOST_PROFILE_WIN},
+        {"auto", HOST_OVERRIDE_AUTO, HOST_PROFILE_WIN},
+    };
+
+    for (const auto &s : sequences) {
+        host_clear_log();
+        leader(s.sequence);
+        EXPECT_EQ(userspace_config.host_override, s.override) << s.sequence;
+        EXPECT_EQ(host_profile_get(), s.profile) << s.sequence;
+        EXPECT_EQ(host_counts.eeprom_writes, 1u) << s.sequence;
+    }
+
+    // The override outlives a reboot, detection does not replace it
+    leader("mac");
+    host_reboot();
+    host_detect_os(OS_WINDOWS);
+    EXPECT_EQ(host_profile_get(), HOST_PROFILE_MAC);
+}
+
+TEST_F(HostTest, LeaderUnknownSequenceDoesNothing) {
+    leader("zzz");
+    EXPECT_EQ(layer_state, 0u);
+    EXPECT_EQ(host_report_count, 0u) << reports();
+    EXPECT_STREQ(host_text, "");
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+}
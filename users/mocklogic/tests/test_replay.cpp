@@ -0,0 +1,46 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Key event traces (features/trace.c) replayed from tables made by
+// tools/trace_decode.py --c. To turn a bug report into a test, save the
+// typed Leader + TRACE dump, decode it into traces/ and assert here what the
+// keyboard should have sent.
+
+#include "host_test.h"
+
+#include "traces/kiddo_exit_interrupted.h"
+#include "traces/select_word_shift_release.h"
+
+// The traces hold matrix positions of the Q3 test board
+class ReplayTest : public HostTest {
+   protected:
+    void SetUp() override {
+        HostTest::SetUp();
+#ifndef KEYBOARD_keychron_q3
+        GTEST_SKIP() << "traces recorded on the Q3 test board";
+#endif
+    }
+};
+
+TEST_F(ReplayTest, ReplaySelectWordShiftRelease) {
+    replay(select_word_shift_release);
+
+    // Line selection, extended while held; Shift is not restored after its
+    // release during the hold, so "x" is lower case
+    EXPECT_EQ(reports(), "S HOME - S+END S S+DOWN S S+DOWN S S+DOWN S - X -");
+    EXPECT_STREQ(host_text, "x");
+    EXPECT_EQ(get_mods(), 0);
+    EXPECT_EQ(host_hook_times[HOST_HOOK_PROCESS_RECORD_USER].count, ARRAY_SIZE(select_word_shift_release));
+}
+
+TEST_F(ReplayTest, ReplayKiddoExitInterrupted) {
+    replay(kiddo_exit_interrupted);
+
+    // Kiddo blocks every key, ESC included: had the interrupted double tap
+    // left the layer, the later ESC presses would reach the host. Layer
+    // changes: FN on and off, leader on and off, Kiddo on and off.
+    EXPECT_EQ(reports(), "");
+    EXPECT_EQ(layer_state, 0u);
+    EXPECT_EQ(host_hook_times[HOST_HOOK_LEADER_END_USER].count, 1u);
+    EXPECT_EQ(host_hook_times[HOST_HOOK_LAYER_STATE_SET_USER].count, 6u);
+}
@@ -0,0 +1,79 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// RGB idle stages (features/rgb_idle.c), drawn frame by frame over the column
+// rain effect, which animates at any speed until something replaces it.
+
+#include "host_test.h"
+
+#include "rgb_idle.h"
+
+#include <vector>
+
+class RgbIdleTest : public HostTest {
+   protected:
+    void SetUp() override {
+        HostTest::SetUp();
+        leader("rgb");
+        tap(_RGB_CFG, RGB_EFF_DIGRAIN);
+        for (uint8_t i = 0; i < 8; i++) {
+            tap(_RGB_CFG, RGB_BRIGHT_UP);
+        }
+        tap(_RGB_CFG, LAYER_EXIT);
+        tap(_RGB_CFG, LAYER_EXIT);
+        ASSERT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_CUSTOM_column_rain);
+        ASSERT_GT(rgb_matrix_get_val(), 0);
+        host_clear_log();
+    }
+
+    static std::vector<uint8_t> frame(void) {
+        host_render_frame();
+        const uint8_t *bytes = (const uint8_t *)host_leds;
+        return std::vector<uint8_t>(bytes, bytes + sizeof(host_leds));
+    }
+
+    // Frames rendered every 16 ms over the given time all match the first
+    static bool still(uint32_t ms) {
+        std::vector<uint8_t> first = frame();
+        for (uint32_t t = 0; t < ms; t += 16) {
+            host_idle(16);
+            if (frame() != first) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+TEST_F(RgbIdleTest, AnimatesWhileActive) {
+    EXPECT_FALSE(still(1000));
+}
+
+TEST_F(RgbIdleTest, StaticStageStopsTheAnimation) {
+    host_idle(RGB_IDLE_STATIC_TIMEOUT + 100);
+    EXPECT_TRUE(rgb_matrix_is_enabled());
+    EXPECT_TRUE(still(2000));
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+    EXPECT_EQ(host_counts.rgb_mode, 0u) << "idling is not saved";
+}
+
+TEST_F(RgbIdleTest, KeyRestoresEffectAndBrightness) {
+    uint8_t val = rgb_matrix_get_val();
+    host_idle(RGB_IDLE_STATIC_TIMEOUT + 100);
+    EXPECT_LT(rgb_matrix_get_val(), val);
+
+    tap(base_layer(), KC_LCTL);
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_CUSTOM_column_rain);
+    EXPECT_EQ(rgb_matrix_get_val(), val);
+    EXPECT_FALSE(still(1000));
+}
+
+TEST_F(RgbIdleTest, OffStageAndBack) {
+    host_idle(RGB_IDLE_OFF_TIMEOUT + 100);
+    EXPECT_FALSE(rgb_matrix_is_enabled());
+
+    tap(base_layer(), KC_LCTL);
+    EXPECT_TRUE(rgb_matrix_is_enabled());
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_CUSTOM_column_rain);
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+}
@@ -0,0 +1,114 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// RGB presets (features/rgb_presets.c) and the RGB config layer: every preset
+// change sets the effect mode once and saves the config once.
+
+#include "host_test.h"
+
+TEST_F(HostTest, BootAppliesDefaultPresetOnce) {
+    host_boot();
+    EXPECT_EQ(host_counts.rgb_mode, 1u);
+    EXPECT_EQ(host_counts.rgb_mode_noeeprom, 0u);
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_SOLID_COLOR);
+    EXPECT_EQ(userspace_config.active_rgb_preset, 1);
+}
+
+TEST_F(HostTest, RebootFromValidEepromDoesNotWrite) {
+    host_reboot();
+    EXPECT_EQ(host_counts.rgb_mode, 1u);
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+}
+
+TEST_F(HostTest, PresetKeysSetModeAndSaveOnce) {
+    const uint16_t presets[] = {RGB_PRESET_1, RGB_PRESET_2, RGB_PRESET_3, RGB_PRESET_4};
+    const uint8_t  modes[]   = {RGB_MATRIX_SOLID_COLOR, RGB_MATRIX_SOLID_COLOR, RGB_MATRIX_SOLID_COLOR, RGB_MATRIX_CUSTOM_sparse_heatmap};
+
+    for (uint8_t i = 0; i < ARRAY_SIZE(presets); i++) {
+        host_clear_log();
+        fn_tap(presets[i]);
+        EXPECT_EQ(host_counts.rgb_mode, 1u) << "preset " << i + 1;
+        EXPECT_EQ(host_counts.rgb_mode_noeeprom, 0u) << "preset " << i + 1;
+        EXPECT_EQ(host_counts.eeprom_writes, 1u) << "preset " << i + 1;
+        EXPECT_EQ(rgb_matrix_get_mode(), modes[i]) << "preset " << i + 1;
+        EXPECT_EQ(userspace_config.active_rgb_preset, i);
+        EXPECT_EQ(host_report_count, 0u) << "preset keys send nothing: " << reports();
+    }
+}
+
+TEST_F(HostTest, PresetSurvivesReboot) {
+    fn_tap(RGB_PRESET_3);
+    host_reboot();
+    EXPECT_EQ(userspace_config.active_rgb_preset, 2);
+    EXPECT_EQ(host_counts.rgb_mode, 1u);
+}
+
+TEST_F(HostTest, ConfigLayerSavesOnlyOnExit) {
+    leader("rgb");
+    EXPECT_TRUE(layer_state_is(_RGB_CFG));
+    EXPECT_EQ(host_counts.rgb_mode, 1u);
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+
+    tap(_RGB_CFG, RGB_EFF_RIVER);
+    EXPECT_EQ(host_counts.rgb_mode, 2u);
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_RIVERFLOW);
+
+    for (uint8_t i = 0; i < 3; i++) {
+        tap(_RGB_CFG, RGB_BRIGHT_DOWN);
+        tap(_RGB_CFG, RGB_SPEED_UP);
+    }
+    EXPECT_EQ(host_counts.rgb_mode, 2u) << "adjustments keep the effect";
+    EXPECT_EQ(host_counts.eeprom_writes, 0u) << "adjustments are not saved until exit";
+
+    tap(_RGB_CFG, LAYER_EXIT);
+    tap(_RGB_CFG, LAYER_EXIT);
+    EXPECT_FALSE(layer_state_is(_RGB_CFG));
+    EXPECT_LE(host_counts.eeprom_writes, 2u);
+    EXPECT_EQ(userspace_config.active_rgb_preset, 3);
+    EXPECT_EQ(userspace_config.rgb_preset_mode, RGB_MATRIX_RIVERFLOW);
+
+    host_clear_log();
+    host_reboot();
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_RIVERFLOW);
+}
+
+TEST_F(HostTest, KiddoLayerRestoresPresetOnExit) {
+    leader("kiddo");
+    EXPECT_TRUE(layer_state_is(_KIDDO));
+    EXPECT_EQ(host_counts.rgb_mode, 0u);
+    EXPECT_EQ(host_counts.rgb_mode_noeeprom, 1u);
+
+    tap(_KIDDO, LAYER_EXIT);
+    tap(_KIDDO, LAYER_EXIT);
+    EXPECT_FALSE(layer_state_is(_KIDDO));
+    EXPECT_EQ(host_counts.rgb_mode, 1u);
+    EXPECT_EQ(rgb_matrix_get_mode(), RGB_MATRIX_SOLID_COLOR);
+}
+
+TEST_F(HostTest, PresetModeFromOlderFirmwareIsRenumbered) {
+    // Indices before the framebuffer effects were dropped
+    const struct {
+        uint8_t old_mode;
+        uint8_t mode;
+    } modes[] = {
+        {4, RGB_MATRIX_CUSTOM_sparse_heatmap},  // TYPING_HEATMAP
+        {5, RGB_MATRIX_CUSTOM_column_rain},     // DIGITAL_RAIN
+        {6, RGB_MATRIX_MULTISPLASH},
+        {8, RGB_MATRIX_RIVERFLOW},
+    };
+
+    for (const auto &m : modes) {
+        userspace_config.rgb_preset_mode    = m.old_mode;
+        userspace_config.rgb_preset_mode_v2 = false;
+        userspace_config_save();
+        host_reboot();
+        EXPECT_EQ(userspace_config.rgb_preset_mode, m.mode) << "old mode " << (int)m.old_mode;
+        EXPECT_TRUE(userspace_config.rgb_preset_mode_v2);
+        EXPECT_EQ(host_counts.eeprom_writes, 1u) << "old mode " << (int)m.old_mode;
+
+        // Renumbered once
+        host_reboot();
+        EXPECT_EQ(userspace_config.rgb_preset_mode, m.mode) << "old mode " << (int)m.old_mode;
+        EXPECT_EQ(host_counts.eeprom_writes, 0u) << "old mode " << (int)m.old_mode;
+    }
+}
@@ -0,0 +1,104 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Select word (features/select_word.c): the exact HID reports each host
+// profile gets, and the user's modifiers around a hold.
+
+#include "host_test.h"
+
+class SelectWordTest : public HostTest {
+   protected:
+    void SetUp() override {
+        HostTest::SetUp();
+        keypos_t pos;
+        if (!host_find_key(base_layer(), SELWORD, &pos)) {
+            GTEST_SKIP() << "no SELWORD key on this board";
+        }
+    }
+
+    void use_mac(void) {
+        leader("mac");
+        ASSERT_EQ(host_profile_get(), HOST_PROFILE_MAC);
+        host_clear_log();
+    }
+
+    static void selword_tap(void) {
+        tap(base_layer(), SELWORD);
+    }
+};
+
+TEST_F(SelectWordTest, WinWord) {
+    selword_tap();
+    EXPECT_EQ(reports(), "C+RGHT C C+LEFT C CS+RGHT CS -");
+    EXPECT_EQ(get_mods(), 0);
+
+    // The next tap within the tap term extends by one word
+    host_clear_log();
+    selword_tap();
+    EXPECT_EQ(reports(), "CS+RGHT CS -");
+}
+
+TEST_F(SelectWordTest, MacWord) {
+    use_mac();
+    selword_tap();
+    EXPECT_EQ(reports(), "A+RGHT A A+LEFT A SA+RGHT SA -");
+    EXPECT_EQ(get_mods(), 0);
+}
+
+TEST_F(SelectWordTest, WinReverseWord) {
+    press(base_layer(), KC_LALT);
+    selword_tap();
+    release(base_layer(), KC_LALT);
+    EXPECT_EQ(reports(), "A C+LEFT C C+RGHT C CS+LEFT CS A -");
+}
+
+TEST_F(SelectWordTest, WinLine) {
+    press(base_layer(), KC_LSFT);
+    selword_tap();
+    release(base_layer(), KC_LSFT);
+    EXPECT_EQ(reports(), "S HOME - S+END S -");
+}
+
+TEST_F(SelectWordTest, MacLine) {
+    use_mac();
+    press(base_layer(), KC_LSFT);
+    selword_tap();
+    release(base_layer(), KC_LSFT);
+    EXPECT_EQ(reports(), "S C+A C CS+E CS S -");
+}
+
+TEST_F(SelectWordTest, HoldRepeatsExtend) {
+    press(base_layer(), SELWORD);
+    host_idle(SELECT_WORD_REPEAT_DELAY + 2 * SELECT_WORD_REPEAT_INTERVAL + 5);
+    release(base_layer(), SELWORD);
+
+    // Start, then one extend at the delay and one per interval after it
+    EXPECT_EQ(reports(), "C+RGHT C C+LEFT C CS+RGHT CS CS+RGHT CS CS+RGHT CS CS+RGHT CS -");
+    EXPECT_EQ(get_mods(), 0);
+}
+
+TEST_F(SelectWordTest, ModifierReleasedDuringHoldIsNotRestored) {
+    press(base_layer(), KC_LSFT);
+    host_idle(10);
+    press(base_layer(), SELWORD);
+    host_idle(10);
+    release(base_layer(), KC_LSFT);
+    host_idle(10);
+    release(base_layer(), SELWORD);
+
+    EXPECT_EQ(get_mods(), 0) << reports();
+    EXPECT_EQ(describe(host_reports[host_report_count - 1]), "-") << reports();
+}
+
+TEST_F(SelectWordTest, ModifierPressedDuringHoldIsRestored) {
+    press(base_layer(), SELWORD);
+    host_idle(10);
+    press(base_layer(), KC_LCTL);
+    host_idle(10);
+    release(base_layer(), SELWORD);
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LCTL)) << reports();
+    EXPECT_EQ(describe(host_reports[host_report_count - 1]), "C") << reports();
+
+    release(base_layer(), KC_LCTL);
+    EXPECT_EQ(get_mods(), 0);
+}
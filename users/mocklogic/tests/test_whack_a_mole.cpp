@@ -0,0 +1,157 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Whack-a-mole on the Kiddo layer (features/whack_a_mole.c), played on the
+// virtual clock: moles are found by rendering the indicators.
+
+#include "host_test.h"
+
+#include <vector>
+
+class WhackAMoleTest : public HostTest {
+   protected:
+    void SetUp() override {
+        HostTest::SetUp();
+        leader("kiddo");
+        ASSERT_TRUE(layer_state_is(_KIDDO));
+        exit_led = led_at(find(_KIDDO, LAYER_EXIT));
+        host_clear_log();
+    }
+
+    static uint8_t led_at(keypos_t pos) {
+        return g_led_config.matrix_co[pos.row][pos.col];
+    }
+
+    static keypos_t led_pos(uint8_t led) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                if (g_led_config.matrix_co[row][col] == led) {
+                    return (keypos_t){col, row};
+                }
+            }
+        }
+        ADD_FAILURE() << "LED " << (int)led << " has no key";
+        return (keypos_t){0, 0};
+    }
+
+    // LEDs lit by the game (the LAYER_EXIT key is always lit)
+    std::vector<uint8_t> lit(void) const {
+        host_render_indicators();
+        std::vector<uint8_t> leds;
+        for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+            const RGB &rgb = host_leds[led];
+            if (led != exit_led && (rgb.r || rgb.g || rgb.b)) {
+                leds.push_back(led);
+            }
+        }
+        return leds;
+    }
+
+    uint8_t mole(void) const {
+        std::vector<uint8_t> leds = lit();
+        EXPECT_EQ(leds.size(), 1u);
+        return leds.empty() ? NO_LED : leds[0];
+    }
+
+    static void whack(uint8_t led) {
+        keypos_t pos = led_pos(led);
+        host_key_event(pos.row, pos.col, true);
+        host_idle(30);
+        host_key_event(pos.row, pos.col, false);
+        host_idle(70);
+    }
+
+    void leave_kiddo(void) {
+        tap(_KIDDO, LAYER_EXIT);
+        tap(_KIDDO, LAYER_EXIT);
+        ASSERT_FALSE(layer_state_is(_KIDDO));
+    }
+
+    uint8_t exit_led = NO_LED;
+};
+
+TEST_F(WhackAMoleTest, StartsWithOneMoleAndExitKey) {
+    uint8_t led = mole();
+    EXPECT_NE(led, NO_LED);
+    // Purple, through the board's white balance
+    RGB purple = {RGB_PURPLE};
+    color_balance_batch(&purple, 1);
+    const RGB &exit = host_leds[exit_led];
+    EXPECT_EQ(exit.r, purple.r);
+    EXPECT_EQ(exit.g, purple.g);
+    EXPECT_EQ(exit.b, purple.b);
+}
+
+TEST_F(WhackAMoleTest, MoleStaysForItsMinimumTime) {
+    uint8_t led = mole();
+    host_idle(900);
+    EXPECT_EQ(mole(), led);
+}
+
+TEST_F(WhackAMoleTest, MoleMovesAfterItsMaximumTime) {
+    uint8_t led = mole();
+    // Level 0 moles stay 1 to 2 seconds
+    host_idle(2 * 1000 + 2 * WHACK_A_MOLE_TICK_MS);
+    EXPECT_NE(mole(), led);
+}
+
+TEST_F(WhackAMoleTest, HitCelebratesThenShowsNextMole) {
+    uint8_t led = mole();
+    whack(led);
+    EXPECT_EQ(host_report_count, 0u) << "game keys are not typed: " << reports();
+    EXPECT_GT(lit().size(), 1u) << "ripple";
+
+    host_idle(500);
+    uint8_t next = mole();
+    EXPECT_NE(next, NO_LED);
+    EXPECT_NE(next, led);
+}
+
+TEST_F(WhackAMoleTest, MissIsConsumedAndNotScored) {
+    uint8_t  led   = mole();
+    keypos_t other = find(base_layer(), KC_Q);
+    if (led_at(other) == led) {
+        other = find(base_layer(), KC_W);
+    }
+    host_key_event(other.row, other.col, true);
+    host_idle(30);
+    host_key_event(other.row, other.col, false);
+
+    EXPECT_EQ(host_report_count, 0u) << reports();
+    EXPECT_EQ(mole(), led);
+
+    leave_kiddo();
+    EXPECT_EQ(whack_a_mole_get_high_score(0), 0);
+}
+
+TEST_F(WhackAMoleTest, ExitSavesHighScoreOnce) {
+    for (uint8_t i = 0; i < 3; i++) {
+        whack(mole());
+        host_idle(500);
+    }
+    EXPECT_EQ(host_counts.eeprom_writes, 0u) << "no writes while playing";
+
+    leave_kiddo();
+    EXPECT_EQ(host_counts.eeprom_writes, 1u);
+
+    host_clear_log();
+    leader("mole");
+    EXPECT_STREQ(host_text, "    3\n    0\n    0\n");
+}
+
+TEST_F(WhackAMoleTest, NoScoreNoWrite) {
+    host_idle(3000);
+    leave_kiddo();
+    EXPECT_EQ(host_counts.eeprom_writes, 0u);
+}
+
+TEST_F(WhackAMoleTest, LevelsAddMoles) {
+    for (uint8_t i = 0; i < 2 * WHACK_A_MOLE_HITS_PER_LEVEL; i++) {
+        std::vector<uint8_t> leds = lit();
+        ASSERT_FALSE(leds.empty());
+        whack(leds[0]);
+        host_idle(500);
+    }
+    // Level 2 shows two moles at once
+    EXPECT_EQ(lit().size(), 2u);
+}
@@ -0,0 +1,40 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Leader + KIDDO, then ESC, F1, ESC (the F1 press breaks the double tap),
+// and a real ESC double tap one second later.
+// Recorded with Leader + TRACE on the host runtime (Q3 keymap), the dump's
+// own Leader + TRACE presses cut off.
+
+// Generated by users/mocklogic/tools/trace_decode.py
+static const struct {
+    uint16_t delta_ms;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+} kiddo_exit_interrupted[] = {
+    {    0,  5,  5, true },
+    {   30,  5,  6, true },
+    {   30,  5,  6, false},
+    {   70,  5,  5, false},
+    {   70,  3,  8, true },
+    {   30,  3,  8, false},
+    {   70,  2,  8, true },
+    {   30,  2,  8, false},
+    {   70,  3,  3, true },
+    {   30,  3,  3, false},
+    {   70,  3,  3, true },
+    {   30,  3,  3, false},
+    {   70,  2,  9, true },
+    {   30,  2,  9, false},
+    {  580,  0,  0, true },
+    {   30,  0,  0, false},
+    {   70,  0,  1, true },
+    {   30,  0,  1, false},
+    {  120,  0,  0, true },
+    {   30,  0,  0, false},
+    { 1070,  0,  0, true },
+    {   30,  0,  0, false},
+    {   70,  0,  0, true },
+    {   30,  0,  0, false},
+};
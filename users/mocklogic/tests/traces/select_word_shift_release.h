@@ -0,0 +1,22 @@
+// Copyright 2025 MockLogic (@mocklogic)
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Shift held, select word pressed, Shift released during the hold (auto
+// repeat running), select word released, then "x" typed.
+// Recorded with Leader + TRACE on the host runtime (Q3 keymap), the dump's
+// own Leader + TRACE presses cut off.
+
+// Generated by users/mocklogic/tools/trace_decode.py
+static const struct {
+    uint16_t delta_ms;
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+} select_word_shift_release[] = {
+    {    0,  4,  0, true },
+    {   40,  5,  6, true },
+    {  120,  4,  0, false},
+    {  500,  5,  6, false},
+    {  150,  4,  2, true },
+    {   30,  4,  2, false},
+};
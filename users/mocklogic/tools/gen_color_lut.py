@@ -0,0 +1,76 @@
+# Copyright 2025 MockLogic (@mocklogic)
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""Generate the lookup tables for features/color_math.c.
+
+  hue_wheel[256][3]  RGB at full saturation and value for every hue, using the
+                     same integer math as QMK's hsv_to_rgb(), so table colors
+                     match the built-in effects
+  gamma_lut[256]     Perceptual brightness curve (GAMMA below)
+
+The output is checked in; rerun after changing the gamma:
+
+$ python3 users/mocklogic/tools/gen_color_lut.py
+"""
+
+import os
+import sys
+
+GAMMA = 2.2
+OUTPUT = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'features', 'color_lut.h')
+
+
+def qmk_hue(h):
+    """QMK hsv_to_rgb() with s = v = 255."""
+    v = 255
+    region = h * 6 // 255
+    remainder = (h * 2 - region * 85) * 3
+    p = 0
+    q = (v * (255 - ((255 * remainder) >> 8))) >> 8
+    t = (v * (255 - ((255 * (255 - remainder)) >> 8))) >> 8
+    return {
+        0: (v, t, p), 6: (v, t, p),
+        1: (q, v, p),
+        2: (p, v, t),
+        3: (p, q, v),
+        4: (t, p, v),
+    }.get(region, (v, p, q))
+
+
+def rows(values, per_row):
+    return [', '.join(values[i:i + per_row]) for i in range(0, len(values), per_row)]
+
+
+def render():
+    hue = ['{%3d, %3d, %3d}' % qmk_hue(h) for h in range(256)]
+    gamma = ['%3d' % round(255 * (i / 255) ** GAMMA) for i in range(256)]
+    out = [
+        '// Copyright 2025 MockLogic (@mocklogic)',
+        '// SPDX-License-Identifier: GPL-2.0-or-later',
+        '// Generated by users/mocklogic/tools/gen_color_lut.py - do not edit',
+        '',
+        '#pragma once',
+        '',
+        '// RGB for each hue at full saturation and value (QMK hsv_to_rgb math)',
+        'static const uint8_t PROGMEM hue_wheel[256][3] = {',
+    ]
+    out += ['    %s,' % row for row in rows(hue, 4)]
+    out += [
+        '};',
+        '',
+        '// Linear input -> perceptual brightness (gamma %.1f)' % GAMMA,
+        'static const uint8_t PROGMEM gamma_lut[256] = {',
+    ]
+    out += ['    %s,' % row for row in rows(gamma, 16)]
+    out += ['};', '']
+    return '\n'.join(out)
+
+
+def main():
+    with open(OUTPUT, 'w') as f:
+        f.write(render())
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,214 @@
+# Copyright 2025 MockLogic (@mocklogic)
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""Generate the MockLogic keymap.c files from one logical description.
+
+The Q1, Q3 and GMMK Pro keymaps share the same ten layers and encoder map. Keeping three hand-written copies let them drift, so they
+are now produced from:
+
+  keymap_src/layers.json        logical layers and encoder map
+  keymap_src/boards/<board>.json physical LAYOUT rows (one logical key name
+                                 per position) plus board-only overrides
+
+It also writes keymap_layers.h with compile-time layer masks derived from the
+same description. Run it from anywhere after editing keymap_src:
+
+$ python3 users/mocklogic/tools/gen_keymaps.py
+
+Use --check to only verify that the checked-in files are up to date.
+"""
+
+import argparse
+import glob
+import json
+import os
+import re
+import sys
+
+USER_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+REPO_ROOT = os.path.dirname(os.path.dirname(USER_DIR))
+SRC_DIR = os.path.join(USER_DIR, 'keymap_src')
+LAYERS_H = os.path.join(USER_DIR, 'keymap_layers.h')
+
+GENERATED_NOTE = '// Generated by users/mocklogic/tools/gen_keymaps.py from users/mocklogic/keymap_src - do not edit'
+
+
+def load_json(path):
+    with open(path) as f:
+        return json.load(f)
+
+
+def enum_members(header, enum_pattern):
+    """Names of an enum in mocklogic.h, in order."""
+    m = re.search(enum_pattern + r'\s*\{(.*?)\}', header, re.S)
+    if not m:
+        raise ValueError('enum %s not found in mocklogic.h' % enum_pattern)
+    body = re.sub(r'//[^\n]*', '', m.group(1))
+    return [entry.split('=')[0].strip() for entry in body.split(',') if entry.strip()]
+
+
+def validate(spec):
+    """The description must match the layer enum in mocklogic.h exactly."""
+    with open(os.path.join(USER_DIR, 'mocklogic.h')) as f:
+        header = f.read()
+    layers = [layer['name'] for layer in spec['layers']]
+    if layers != enum_members(header, r'enum\s+mocklogic_layers'):
+        raise ValueError('layers.json layer order does not match enum mocklogic_layers')
+
+
+def resolve_layer(spec, layer, board):
+    """Keycode for every logical key on this board."""
+    names = [name for row in board['rows'] for name in row]
+    overrides = board.get('overrides', {}).get(layer['name'], {})
+    for name in overrides:
+        if name not in names:
+            raise ValueError('%s override for %s: no key %s on this board' % (board['name'], layer['name'], name))
+
+    keys = {}
+    for name in names:
+        if name in overrides:
+            keys[name] = overrides[name]
+        elif name in layer['keys']:
+            keys[name] = layer['keys'][name]
+        elif layer['fill'] == 'base':
+            keys[name] = spec['base_defaults'].get(name, 'KC_' + name)
+        else:
+            keys[name] = layer['fill']
+    return keys
+
+
+def render_rows(board, keys):
+    lines = []
+    for i, row in enumerate(board['rows']):
+        last_row = i == len(board['rows']) - 1
+        cells = []
+        for j, name in enumerate(row):
+            last = last_row and j == len(row) - 1
+            cells.append(keys[name] if last else (keys[name] + ',').ljust(9))
+        lines.append('        ' + ''.join(cells).rstrip())
+    return '\n'.join(lines)
+
+
+def render_keymap(spec, board):
+    out = [
+        '// Copyright 2025 MockLogic (@mocklogic)',
+        '// SPDX-License-Identifier: GPL-2.0-or-later',
+        GENERATED_NOTE,
+        '',
+        '#include QMK_KEYBOARD_H',
+        '#include "mocklogic.h"',
+        '',
+        '// ============================================================================',
+        '// Keymap Layers',
+        '// ' + board['note'],
+        '// ============================================================================',
+        '',
+        'const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {',
+    ]
+    layers = []
+    for layer in spec['layers']:
+        keys = resolve_layer(spec, layer, board)
+        layers.append('    // %s\n    [%s] = %s(\n%s\n    )' % (layer['comment'], layer['name'], board['layout'], render_rows(board, keys)))
+    out.append(',\n\n'.join(layers))
+    out += ['};', '']
+
+    out += [
+        '// ============================================================================',
+        '// Encoder Configuration',
+        '// ============================================================================',
+        '',
+        '#if defined(ENCODER_MAP_ENABLE)',
+        'const uint16_t PROGMEM encoder_map[][NUM_ENCODERS][NUM_DIRECTIONS] = {',
+    ]
+    width = max(len(layer['name']) for layer in spec['layers']) + 2
+    for i, layer in enumerate(spec['layers']):
+        line = '    %s= {ENCODER_CCW_CW(%s, %s)}' % (('[%s]' % layer['name']).ljust(width + 1), layer['encoder'][0], layer['encoder'][1])
+        if i < len(spec['layers']) - 1:
+            line += ','
+        if 'encoder_comment' in layer:
+            line += '  // ' + layer['encoder_comment']
+        out.append(line)
+    out += ['};', '#endif', '']
+
+    if 'extra' in board:
+        with open(os.path.join(SRC_DIR, 'boards', board['extra'])) as f:
+            out.append(f.read().rstrip('\n'))
+        out.append('')
+
+    out += [
+        '// Note: All RGB indicator logic is now centralized in userspace (users/mocklogic/mocklogic.c)',
+        '// using keycode-based LED control for portability across different keyboards.',
+        '',
+    ]
+    return '\n'.join(out)
+
+
+def layer_mask(names):
+    return ' | '.join('LAYER_MASK(%s)' % name for name in names)
+
+
+def render_layers_h(spec):
+    exit_layers = [layer['name'] for layer in spec['layers'] if 'LAYER_EXIT' in layer['keys'].values()]
+    blocking = [layer['name'] for layer in spec['layers'] if layer['fill'] == 'KC_NO']
+    base = [layer['name'] for layer in spec['layers'] if layer['fill'] == 'base']
+    out = [
+        '// Copyright 2025 MockLogic (@mocklogic)',
+        '// SPDX-License-Identifier: GPL-2.0-or-later',
+        GENERATED_NOTE,
+        '',
+        '#pragma once',
+        '',
+        '// Compile-time layer masks (include after enum mocklogic_layers)',
+        '#define LAYER_MASK(layer) ((layer_state_t)1 << (layer))',
+        '',
+        '#define NUM_MOCKLOGIC_LAYERS %d' % len(spec['layers']),
+        '',
+        '// Default layers (OS base layers)',
+        '#define LAYER_MASK_BASE (%s)' % layer_mask(base),
+        '',
+        '// Layers left with a double-tap on LAYER_EXIT',
+        '#define LAYER_MASK_EXIT (%s)' % layer_mask(exit_layers),
+        '',
+        '// Layers that disable every key they do not define',
+        '#define LAYER_MASK_BLOCKING (%s)' % layer_mask(blocking),
+    ]
+    for name, layers in spec['masks'].items():
+        if name == 'comment':
+            continue
+        out += ['', '// Layers entered together by %s' % name,
+                '#define LAYER_MASK_%s (%s)' % (name, layer_mask(layers))]
+    out.append('')
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('--check', action='store_true', help='fail if a generated file is out of date')
+    args = parser.parse_args()
+
+    spec = load_json(os.path.join(SRC_DIR, 'layers.json'))
+    validate(spec)
+
+    outputs = {LAYERS_H: render_layers_h(spec)}
+    for path in sorted(glob.glob(os.path.join(SRC_DIR, 'boards', '*.json'))):
+        board = load_json(path)
+        board['name'] = os.path.splitext(os.path.basename(path))[0]
+        outputs[os.path.join(REPO_ROOT, board['keymap'])] = render_keymap(spec, board)
+
+    stale = []
+    for path, text in outputs.items():
+        current = open(path).read() if os.path.exists(path) else None
+        if current == text:
+            continue
+        stale.append(os.path.relpath(path, REPO_ROOT))
+        if not args.check:
+            with open(path, 'w') as f:
+                f.write(text)
+
+    for path in stale:
+        print('%s %s' % ('out of date:' if args.check else 'wrote', path))
+    return 1 if args.check and stale else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,359 @@
+# Copyright 2025 MockLogic (@mocklogic)
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""Generate a per-keyboard LED map header for the userspace indicators.
+
+The indicators in mocklogic.c light keys by keycode ("the key that sends
+TASK_MGR on _WIN_FN") so the keymaps stay portable. Resolving that at runtime
+means scanning the whole keymap every frame. This script does the search at
+build time instead: it reads the keyboard's info.json/keyboard.json files,
+the g_led_config initializer in the keyboard sources (if the LED layout is
+not in JSON) and the layers in keymap.c, and writes a header with a
+led_map_lookup() function. Called with constant arguments it folds down to a
+constant LED list, so an indicator becomes a direct rgb_matrix_set_color().
+
+The header also carries the sparse heatmap's neighbor table (the closest
+key LEDs of each key LED, see features/rgb_effects.h) as a PROGMEM const, so
+the effect needs no RAM table and no search at runtime.
+
+It is run from users/mocklogic/rules.mk on every build:
+
+$ python3 gen_led_map.py -o mocklogic_led_map.h --keymap keymap.c \\
+      --json info.json [--json keyboard.json ...] [--source board.c ...] \\
+      [--neighbors N] [--radius R]
+
+If anything cannot be parsed the output is removed and the firmware falls
+back to the runtime search, so a failure here never breaks the build.
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+# Keycodes that never need an indicator - left out to keep the header small
+SKIPPED_KEYCODES = {'_______', 'KC_TRNS', 'KC_TRANSPARENT'}
+
+# Defaults of the sparse heatmap neighbor table size, read from here unless
+# rules.mk passes --neighbors/--radius (the effect only uses a table built
+# for its own values, and searches at runtime otherwise)
+RGB_EFFECTS_H = os.path.join(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), 'features', 'rgb_effects.h')
+
+LED_FLAGS = {
+    'LED_FLAG_NONE': 0x00,
+    'LED_FLAG_MODIFIER': 0x01,
+    'LED_FLAG_UNDERGLOW': 0x02,
+    'LED_FLAG_KEYLIGHT': 0x04,
+    'LED_FLAG_INDICATOR': 0x08,
+    'LED_FLAG_ALL': 0xFF,
+}
+LED_FLAG_KEYLIGHT = LED_FLAGS['LED_FLAG_KEYLIGHT']
+
+# Common aliases, so the same key is emitted once per layer
+KEYCODE_ALIASES = {
+    'XXXXXXX': 'KC_NO',
+    'KC_ESCAPE': 'KC_ESC',
+    'KC_CAPS_LOCK': 'KC_CAPS',
+}
+
+
+def strip_comments(text):
+    """Remove C/C++ comments while keeping string literals intact."""
+    pattern = re.compile(r'//[^\n]*|/\*.*?\*/|"(?:\\.|[^"\\])*"', re.S)
+    return pattern.sub(lambda m: m.group(0) if m.group(0).startswith('"') else ' ', text)
+
+
+def split_args(text):
+    """Split a C argument list on top-level commas."""
+    args, depth, current = [], 0, []
+    for ch in text:
+        if ch in '([{':
+            depth += 1
+        elif ch in ')]}':
+            depth -= 1
+        if ch == ',' and depth == 0:
+            args.append(''.join(current).strip())
+            current = []
+        else:
+            current.append(ch)
+    if ''.join(current).strip():
+        args.append(''.join(current).strip())
+    return args
+
+
+def matching_close(text, start):
+    """Index of the bracket closing the one at text[start]."""
+    pairs = {'(': ')', '{': '}', '[': ']'}
+    opener, closer, depth = text[start], pairs[text[start]], 0
+    for i in range(start, len(text)):
+        if text[i] == opener:
+            depth += 1
+        elif text[i] == closer:
+            depth -= 1
+            if depth == 0:
+                return i
+    raise ValueError('unbalanced %s' % opener)
+
+
+def deep_merge(base, extra):
+    for key, value in extra.items():
+        if isinstance(value, dict) and isinstance(base.get(key), dict):
+            deep_merge(base[key], value)
+        else:
+            base[key] = value
+    return base
+
+
+def load_info(paths):
+    """Merge info.json/keyboard.json files, least specific first."""
+    info = {}
+    for path in paths:
+        with open(path) as f:
+            deep_merge(info, json.load(f))
+    return info
+
+
+def parse_keymap_layers(keymap_c):
+    """Return [(layer_expr, layout_macro, [keycode, ...]), ...] from keymap.c."""
+    text = strip_comments(keymap_c)
+    start = re.search(r'keymaps\s*\[\s*\]\s*\[\s*MATRIX_ROWS\s*\]\s*\[\s*MATRIX_COLS\s*\]\s*=\s*\{', text)
+    if not start:
+        raise ValueError('keymaps[] not found')
+    body_start = start.end() - 1
+    body = text[body_start + 1:matching_close(text, body_start)]
+
+    layers = []
+    for m in re.finditer(r'\[\s*([^\]]+?)\s*\]\s*=\s*(\w+)\s*\(', body):
+        args_start = m.end() - 1
+        args = split_args(body[args_start + 1:matching_close(body, args_start)])
+        layers.append((m.group(1), m.group(2), args))
+    if not layers:
+        raise ValueError('no layers found in keymaps[]')
+    return layers
+
+
+def layout_positions(info, macro):
+    """Matrix (row, col) for each argument of a LAYOUT macro."""
+    layouts = info.get('layouts', {})
+    macro = info.get('layout_aliases', {}).get(macro, macro)
+    if macro not in layouts:
+        raise ValueError('%s not described in info.json' % macro)
+    return [tuple(key['matrix']) for key in layouts[macro]['layout']]
+
+
+def led_matrix_from_info(info):
+    """{(row, col): led} from rgb_matrix.layout, or None if not in JSON."""
+    layout = info.get('rgb_matrix', {}).get('layout')
+    if not layout:
+        return None
+    return {tuple(led['matrix']): index for index, led in enumerate(layout) if 'matrix' in led}
+
+
+def led_matrix_from_source(sources):
+    """{(row, col): led} from a C g_led_config initializer, or None."""
+    for path in sources:
+        with open(path) as f:
+            text = strip_comments(f.read())
+        m = re.search(r'led_config_t\s+g_led_config\s*=\s*\{', text)
+        if not m:
+            continue
+        # First member is matrix_co: { {row0...}, {row1...}, ... }
+        outer = m.end() - 1
+        inner = text.index('{', outer + 1)
+        matrix_co = text[inner + 1:matching_close(text, inner)]
+        leds = {}
+        row = 0
+        for rm in re.finditer(r'\{([^{}]*)\}', matrix_co):
+            for col, token in enumerate(split_args(rm.group(1))):
+                if re.fullmatch(r'\d+', token):
+                    leds[(row, col)] = int(token)
+            row += 1
+        return leds
+    return None
+
+
+def parse_led_flags(token):
+    """Value of a g_led_config flags entry such as 4 or LED_FLAG_MODIFIER | LED_FLAG_KEYLIGHT."""
+    value = 0
+    for part in token.replace('(', ' ').replace(')', ' ').split('|'):
+        part = part.strip()
+        value |= LED_FLAGS[part] if part in LED_FLAGS else int(part, 0)
+    return value
+
+
+def led_layout_from_info(info):
+    """[((row, col) or None, x, y, flags), ...] per LED from rgb_matrix.layout, or None."""
+    layout = info.get('rgb_matrix', {}).get('layout')
+    if not layout:
+        return None
+    return [(tuple(led['matrix']) if 'matrix' in led else None, led['x'], led['y'], led.get('flags', 0)) for led in layout]
+
+
+def led_layout_from_source(sources):
+    """Same as led_layout_from_info, from a C g_led_config initializer."""
+    for path in sources:
+        with open(path) as f:
+            text = strip_comments(f.read())
+        m = re.search(r'led_config_t\s+g_led_config\s*=\s*\{', text)
+        if not m:
+            continue
+        outer = m.end() - 1
+        members = split_args(text[outer + 1:matching_close(text, outer)])
+        if len(members) < 3:
+            raise ValueError('%s: g_led_config needs matrix, points and flags' % path)
+
+        matrix = {}
+        for row, rm in enumerate(re.finditer(r'\{([^{}]*)\}', members[0].strip()[1:-1])):
+            for col, token in enumerate(split_args(rm.group(1))):
+                if re.fullmatch(r'\d+', token):
+                    matrix[int(token)] = (row, col)
+        points = [(int(x, 0), int(y, 0)) for x, y in re.findall(r'\{\s*(\w+)\s*,\s*(\w+)\s*\}', members[1])]
+        flags = [parse_led_flags(token) for token in split_args(members[2].strip()[1:-1])]
+        if len(points) != len(flags):
+            raise ValueError('%s: %d LED points but %d flags' % (path, len(points), len(flags)))
+        return [(matrix.get(i), x, y, f) for i, ((x, y), f) in enumerate(zip(points, flags))]
+    return None
+
+
+def heatmap_defaults(path=RGB_EFFECTS_H):
+    """(SPARSE_HEATMAP_NEIGHBORS, SPARSE_HEATMAP_SPREAD_RADIUS) as defaulted in features/rgb_effects.h."""
+    with open(path) as f:
+        defines = dict(re.findall(r'^#\s*define\s+(SPARSE_HEATMAP_\w+)\s+(\d+)', f.read(), re.M))
+    return int(defines['SPARSE_HEATMAP_NEIGHBORS']), int(defines['SPARSE_HEATMAP_SPREAD_RADIUS'])
+
+
+def build_neighbors(layout, count, radius):
+    """Closest key LEDs of each key LED, nearest first (ties by index), as rgb_effects.c would pick them."""
+    keys = [i for i, (_, _, _, flags) in enumerate(layout) if flags & LED_FLAG_KEYLIGHT]
+    table = []
+    for i, (_, x, y, flags) in enumerate(layout):
+        near = []
+        if flags & LED_FLAG_KEYLIGHT:
+            for j in keys:
+                d = (layout[j][1] - x) ** 2 + (layout[j][2] - y) ** 2
+                if j != i and d <= radius ** 2:
+                    near.append((d, j))
+        table.append([j for _, j in sorted(near)[:count]])
+    return table
+
+
+def render_neighbors(table, count, radius):
+    """Header lines with led_map_neighbor(), for features/rgb_effects.c."""
+    lines = [
+        '// Sparse heatmap neighbors: closest key LEDs within %d units, nearest first' % radius,
+        '#define LED_MAP_NEIGHBORS %d' % count,
+        '#define LED_MAP_NEIGHBOR_RADIUS %d' % radius,
+        '',
+        'static inline uint8_t led_map_neighbor(uint8_t led, uint8_t k) {',
+        '    static const uint8_t PROGMEM neighbors[][LED_MAP_NEIGHBORS] = {',
+    ]
+    for near in table:
+        lines.append('        {%s},' % ', '.join(str(j) for j in near + ['NO_LED'] * (count - len(near))))
+    lines += [
+        '    };',
+        '    return pgm_read_byte(&neighbors[led][k]);',
+        '}',
+        '',
+    ]
+    return lines
+
+
+def build_map(layers, info, leds):
+    """[(layer_expr, [(keycode, [led, ...]), ...]), ...] in keymap order."""
+    result = []
+    for layer, macro, keycodes in layers:
+        positions = layout_positions(info, macro)
+        if len(positions) != len(keycodes):
+            raise ValueError('%s on layer %s has %d keys, expected %d' % (macro, layer, len(keycodes), len(positions)))
+        entries = {}
+        for pos, keycode in zip(positions, keycodes):
+            keycode = KEYCODE_ALIASES.get(keycode, keycode)
+            if keycode in SKIPPED_KEYCODES or pos not in leds:
+                continue
+            entries.setdefault(keycode, []).append(leds[pos])
+        result.append((layer, list(entries.items())))
+    return result
+
+
+def render_header(led_map, keyboard, neighbors, count, radius):
+    max_leds = max((len(l) for _, entries in led_map for _, l in entries), default=1)
+    lines = [
+        '// Generated by users/mocklogic/tools/gen_led_map.py for %s - do not edit' % keyboard,
+        '',
+        '#pragma once',
+        '',
+        '#define MOCKLOGIC_LED_MAP',
+        '#define LED_MAP_MAX_PER_KEY %d' % max_leds,
+        '',
+        '// LEDs under a keycode on a layer (raw layer contents, transparent keys excluded).',
+        '// Always inlined: with constant arguments the compiler reduces this to the LED list.',
+        'static inline __attribute__((always_inline)) uint8_t led_map_lookup(uint8_t layer, uint16_t keycode, const uint8_t **leds) {',
+        '    switch (layer) {',
+    ]
+    for layer, entries in led_map:
+        lines.append('        case %s:' % layer)
+        for keycode, led_list in entries:
+            lines.append('            if (keycode == (%s)) { static const uint8_t l[] = {%s}; *leds = l; return %d; }'
+                         % (keycode, ', '.join(str(x) for x in led_list), len(led_list)))
+        lines.append('            break;')
+    lines += [
+        '    }',
+        '    return 0;',
+        '}',
+        '',
+    ]
+    if neighbors is not None:
+        lines += render_neighbors(neighbors, count, radius)
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--keymap', required=True, help='keymap.c with the keymaps[] layers')
+    parser.add_argument('--json', action='append', default=[], help='info.json/keyboard.json, least specific first')
+    parser.add_argument('--source', action='append', default=[], help='keyboard C source with g_led_config')
+    parser.add_argument('--keyboard', default='')
+    parser.add_argument('--neighbors', type=int, help='SPARSE_HEATMAP_NEIGHBORS (default: features/rgb_effects.h)')
+    parser.add_argument('--radius', type=int, help='SPARSE_HEATMAP_SPREAD_RADIUS (default: features/rgb_effects.h)')
+    args = parser.parse_args()
+
+    try:
+        info = load_info(args.json)
+        with open(args.keymap) as f:
+            layers = parse_keymap_layers(f.read())
+        leds = led_matrix_from_info(info)
+        if leds is None:
+            leds = led_matrix_from_source(args.source)
+        if not leds:
+            raise ValueError('no RGB matrix LED layout found')
+        layout = led_layout_from_info(info)
+        if layout is None:
+            try:
+                layout = led_layout_from_source(args.source)
+            except (ValueError, KeyError) as e:
+                print('gen_led_map: %s - heatmap neighbors found at runtime' % e, file=sys.stderr)
+        count, radius = heatmap_defaults()
+        count, radius = args.neighbors or count, args.radius or radius
+        neighbors = build_neighbors(layout, count, radius) if layout else None
+        header = render_header(build_map(layers, info, leds), args.keyboard, neighbors, count, radius)
+    except (OSError, ValueError, KeyError, TypeError) as e:
+        print('gen_led_map: %s - using runtime keymap search' % e, file=sys.stderr)
+        if os.path.exists(args.output):
+            os.remove(args.output)
+        return 0
+
+    # Only touch the file when it changes, so make does not rebuild needlessly
+    if os.path.exists(args.output):
+        with open(args.output) as f:
+            if f.read() == header:
+                return 0
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, 'w') as f:
+        f.write(header)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
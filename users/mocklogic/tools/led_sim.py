@@ -0,0 +1,189 @@
+# Copyright 2025 MockLogic (@mocklogic)
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""Run the userspace RGB effects and layer indicators on the host, against a board's real LED layout.
+
+Builds the userspace (mocklogic.c, the features and this repo's keymap.c for
+the keyboard) on the host test stand-in in tests/host/, with the driver
+tests/led_sim.c, then plays frames on a virtual clock with synthetic typing:
+
+$ python3 users/mocklogic/tools/led_sim.py --board q3 --effect heatmap
+$ python3 users/mocklogic/tools/led_sim.py --board gmmk --layer kiddo --speedup 4
+$ python3 users/mocklogic/tools/led_sim.py --board q1 --layer rgb --effect rain --frames 300 \\
+      --ppm - | ffmpeg -f image2pipe -c:v ppm -framerate 60 -i - rain.gif
+
+Each frame is what rgb_matrix_task() would show: the effect, then the
+userspace indicators of the active layers (--layer brings one up the way a
+user would, with FN held or a leader sequence). Frames are drawn in the
+terminal with 24-bit ANSI colors, or written as concatenated binary PPMs with
+--ppm. Each run ends with the compute time per frame (host CPU, not the MCU -
+compare runs, not absolute numbers).
+
+The matrix, layout macros and LED layout (g_led_config) come from the
+keyboard definition in a QMK checkout (--qmk-home, default $QMK_HOME or
+~/qmk_firmware), read the same way as tools/gen_led_map.py does for the
+firmware build, which also makes the mocklogic_led_map.h the build uses.
+"""
+
+import argparse
+import glob
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+import gen_led_map
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+USER_DIR = os.path.dirname(TOOLS_DIR)
+REPO_DIR = os.path.dirname(os.path.dirname(USER_DIR))
+TESTS_DIR = os.path.join(USER_DIR, 'tests')
+
+BOARDS = {
+    'q1': 'keychron/q1v2/ansi_encoder',
+    'q3': 'keychron/q3/ansi_encoder',
+    'gmmk': 'gmmk/pro/rev1/ansi',
+}
+
+
+def keyboard_paths(qmk_home, keyboard):
+    """keyboards/a, keyboards/a/b, ... - least specific first, like QMK's KEYBOARD_PATHS."""
+    parts = keyboard.split('/')
+    return [os.path.join(qmk_home, 'keyboards', *parts[:i]) for i in range(1, len(parts) + 1)]
+
+
+def keymap_path(keyboard):
+    return os.path.join(REPO_DIR, 'keyboards', keyboard, 'keymaps', 'mocklogic', 'keymap.c')
+
+
+def render_layout_macro(info, macro, rows, cols):
+    """#define lines for a LAYOUT macro, from its matrix positions in info.json."""
+    positions = gen_led_map.layout_positions(info, macro)
+    matrix = [['KC_NO'] * cols for _ in range(rows)]
+    for index, (row, col) in enumerate(positions):
+        matrix[row][col] = 'k%d' % index
+    lines = ['#define %s(%s) { \\' % (macro, ', '.join('k%d' % i for i in range(len(positions))))]
+    lines += ['    {%s}, \\' % ', '.join(row) for row in matrix]
+    lines += ['}', '']
+    return lines
+
+
+def render_board(keyboard, info, leds, macros, rows, cols):
+    """Board header for tests/host/host_board.h (HOST_BOARD_H)."""
+    lines = [
+        '// Generated by users/mocklogic/tools/led_sim.py for %s - do not edit' % keyboard,
+        '',
+        '#pragma once',
+        '',
+        '#define MATRIX_ROWS %d' % rows,
+        '#define MATRIX_COLS %d' % cols,
+        '',
+        '#define RGB_MATRIX_LED_COUNT %d' % len(leds),
+        '',
+        '#define NUM_ENCODERS   %d' % (len(info.get('encoder', {}).get('rotary', [])) or 1),
+        '#define NUM_DIRECTIONS 2',
+        '',
+        '// clang-format off',
+    ]
+    for macro in macros:
+        lines += render_layout_macro(info, macro, rows, cols)
+
+    matrix = [['NO_LED'] * cols for _ in range(rows)]
+    for index, (pos, _, _, _) in enumerate(leds):
+        if pos is not None:
+            matrix[pos[0]][pos[1]] = str(index)
+    lines += ['#define HOST_BOARD_LED_CONFIG { \\', '    { \\']
+    lines += ['        {%s}, \\' % ', '.join(row) for row in matrix]
+    lines += ['    }, \\', '    {%s}, \\' % ', '.join('{%d, %d}' % (x, y) for _, x, y, _ in leds)]
+    lines += ['    {%s}, \\' % ', '.join(str(f) for _, _, _, f in leds), '}', '// clang-format on', '']
+    return '\n'.join(lines)
+
+
+def load_board(qmk_home, keyboard, led_map):
+    """(board header, mocklogic_led_map.h or None) for the keyboard."""
+    paths = keyboard_paths(qmk_home, keyboard)
+    if not os.path.isdir(paths[-1]):
+        raise ValueError('%s not found - is --qmk-home a QMK checkout?' % paths[-1])
+    info = gen_led_map.load_info([p for path in paths for p in (os.path.join(path, 'info.json'), os.path.join(path, 'keyboard.json'))
+                                  if os.path.exists(p)])
+    leds = gen_led_map.led_layout_from_info(info)
+    if leds is None:
+        leds = gen_led_map.led_layout_from_source([c for path in paths for c in sorted(glob.glob(os.path.join(path, '*.c')))])
+    if not leds:
+        raise ValueError('no RGB matrix LED layout found for %s' % keyboard)
+
+    with open(keymap_path(keyboard)) as f:
+        layers = gen_led_map.parse_keymap_layers(f.read())
+    macros = sorted(set(macro for _, macro, _ in layers))
+
+    positions = [pos for pos, _, _, _ in leds if pos is not None]
+    positions += [pos for macro in macros for pos in gen_led_map.layout_positions(info, macro)]
+    if 'matrix_size' in info:
+        rows, cols = info['matrix_size']['rows'], info['matrix_size']['cols']
+    else:
+        rows, cols = max(p[0] for p in positions) + 1, max(p[1] for p in positions) + 1
+    board = render_board(keyboard, info, leds, macros, rows, cols)
+
+    if not led_map:
+        return board, None
+    count, radius = gen_led_map.heatmap_defaults()
+    matrix = {pos: index for index, (pos, _, _, _) in enumerate(leds) if pos is not None}
+    return board, gen_led_map.render_header(gen_led_map.build_map(layers, info, matrix), keyboard,
+                                            gen_led_map.build_neighbors(leds, count, radius), count, radius)
+
+
+def build(workdir, keyboard, files, cc):
+    """Build tests/led_sim.c with the tests' Makefile, the board header in workdir."""
+    for name, text in zip(('host_board_gen.h', 'mocklogic_led_map.h'), files):
+        if text is not None:
+            with open(os.path.join(workdir, name), 'w') as f:
+                f.write(text)
+
+    binary = os.path.join(workdir, 'led_sim')
+    # Without the sanitizers, for the compute times
+    subprocess.run(['make', '-s', '-C', TESTS_DIR, binary, 'KEYBOARD=%s' % keyboard, 'BUILD=%s' % workdir, 'CC=%s' % cc,
+                    'HOST_BOARD_H=%s' % os.path.join(workdir, 'host_board_gen.h'), 'SANITIZE='],
+                   check=True, stdout=sys.stderr)
+    return binary
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0],
+                                     epilog='Other options (--effect, --layer, --frames, --frame-ms, --speedup, --cps, --hit-pct, '
+                                            '--hue, --speed, --seed, --ppm, --scale) go to the simulator.')
+    parser.add_argument('--qmk-home', default=os.environ.get('QMK_HOME', os.path.expanduser('~/qmk_firmware')))
+    board = parser.add_mutually_exclusive_group()
+    board.add_argument('--board', choices=sorted(BOARDS), default='q3')
+    board.add_argument('--keyboard', help='QMK keyboard path, e.g. keychron/q3/ansi_encoder')
+    parser.add_argument('--cc', default=os.environ.get('CC', 'cc'))
+    parser.add_argument('--keep', help='build in this directory and keep it')
+    parser.add_argument('--no-led-map', action='store_true',
+                        help='build without the generated mocklogic_led_map.h (as in a VIA build)')
+    args, sim_args = parser.parse_known_args()
+    keyboard = args.keyboard or BOARDS[args.board]
+
+    try:
+        if not os.path.exists(keymap_path(keyboard)):
+            raise ValueError('no mocklogic keymap for %s' % keyboard)
+        files = load_board(args.qmk_home, keyboard, not args.no_led_map)
+    except (OSError, ValueError, KeyError, TypeError) as e:
+        print('led_sim: %s' % e, file=sys.stderr)
+        return 1
+
+    workdir = args.keep or tempfile.mkdtemp(prefix='led_sim_')
+    os.makedirs(workdir, exist_ok=True)
+    try:
+        binary = build(workdir, keyboard, files, args.cc)
+        return subprocess.run([binary] + sim_args).returncode
+    except subprocess.CalledProcessError:
+        return 1
+    except KeyboardInterrupt:
+        return 130
+    finally:
+        if not args.keep:
+            shutil.rmtree(workdir)
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,121 @@
+# Copyright 2025 MockLogic (@mocklogic)
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+"""Decode a key event trace typed by Leader + TRACE (features/trace.h).
+
+Paste the typed text into a file (anything around the trace block is
+ignored), then:
+
+$ python3 users/mocklogic/tools/trace_decode.py trace.txt          # timeline
+$ python3 users/mocklogic/tools/trace_decode.py --c trace.txt      # C replay table
+
+The timeline lists each event with its absolute time, the gap to the previous
+event, and for releases how long the key was held. The C table (named with
+--name, default trace_events) replays the same matrix events on the host:
+
+$ make -C users/mocklogic/tests replay TRACE=trace.txt [EXPECT=reports.txt]
+
+runs them through the userspace on a virtual clock and prints the HID
+reports and the time spent in each hook (users/mocklogic/tests/replay.c).
+It also works with QMK's test framework (tests/test_common):
+
+    for (const auto &e : trace_events) {
+        idle_for(e.delta_ms);
+        e.pressed ? press_key(e.col, e.row) : release_key(e.col, e.row);
+        run_one_scan_loop();
+    }
+"""
+
+import argparse
+import sys
+
+TRACE_VERSION = 1
+TRACE_MAX_DELTA = 0x3FFF
+
+
+def parse(text):
+    """Return [(delta_ms, row, col, pressed)] from the first trace block."""
+    lines = iter(text.splitlines())
+    for line in lines:
+        fields = line.split()
+        if len(fields) == 3 and fields[0] == 'trace':
+            version, count = int(fields[1]), int(fields[2])
+            break
+    else:
+        raise ValueError('no "trace" header found')
+    if version != TRACE_VERSION:
+        raise ValueError('trace version %d, expected %d' % (version, TRACE_VERSION))
+
+    data = ''
+    for line in lines:
+        line = line.strip()
+        if line == 'end':
+            break
+        data += line
+    else:
+        raise ValueError('trace is missing its "end" line')
+
+    raw = bytes.fromhex(data)
+    if len(raw) != count * 3:
+        raise ValueError('trace has %d bytes, header says %d events' % (len(raw), count))
+
+    events = []
+    for i in range(0, len(raw), 3):
+        word = raw[i] | raw[i + 1] << 8 | raw[i + 2] << 16
+        events.append((word >> 10, (word >> 5) & 0xF, word & 0x1F, bool(word >> 9 & 1)))
+    return events
+
+
+def timeline(events):
+    out = ['    t_ms     dt  row col  event']
+    now = 0
+    down = {}
+    for delta, row, col, pressed in events:
+        now += delta
+        gap = ('>%5d' if delta == TRACE_MAX_DELTA else '%6d') % delta
+        if pressed:
+            down[(row, col)] = now
+            note = 'down'
+        elif (row, col) in down:
+            note = 'up    held %d ms' % (now - down.pop((row, col)))
+        else:
+            note = 'up'
+        out.append('%8d %s  %3d %3d  %s' % (now, gap, row, col, note))
+    return '\n'.join(out)
+
+
+def c_table(events, name='trace_events'):
+    out = [
+        '// Generated by users/mocklogic/tools/trace_decode.py',
+        'static const struct {',
+        '    uint16_t delta_ms;',
+        '    uint8_t  row;',
+        '    uint8_t  col;',
+        '    bool     pressed;',
+        '} %s[] = {' % name,
+    ]
+    out += ['    {%5d, %2d, %2d, %-5s},' % (delta, row, col, 'true' if pressed else 'false') for delta, row, col, pressed in events]
+    out.append('};')
+    return '\n'.join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('file', nargs='?', help='typed trace (default: stdin)')
+    parser.add_argument('--c', action='store_true', help='print a C table for replay instead of the timeline')
+    parser.add_argument('--name', default='trace_events', help='name of the C table (default: trace_events)')
+    args = parser.parse_args()
+
+    text = open(args.file).read() if args.file else sys.stdin.read()
+    try:
+        events = parse(text)
+    except ValueError as e:
+        print('trace_decode: %s' % e, file=sys.stderr)
+        return 1
+
+    print(c_table(events, args.name) if args.c else timeline(events))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())